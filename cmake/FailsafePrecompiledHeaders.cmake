@@ -0,0 +1,30 @@
+# =============================================================================
+# failsafe_target_precompile_headers(<target> [STANDARD_HEADERS])
+#
+# Precompiles the headers failsafe pulls into each translation unit of
+# <target>. By default that is <failsafe/failsafe.hh> itself; the
+# configuration macros (LOGGER_MIN_LEVEL, FAILSAFE_TRAP_MODE, ...) then have
+# to be set for the whole target with target_compile_definitions(), since a
+# #define in front of the #include comes after the precompiled header.
+#
+# With STANDARD_HEADERS only the standard library headers failsafe uses are
+# precompiled, and per-file configuration keeps working.
+# =============================================================================
+
+function(failsafe_target_precompile_headers target)
+    cmake_parse_arguments(ARG "STANDARD_HEADERS" "" "" ${ARGN})
+
+    set(_failsafe_std_headers
+        <algorithm> <array> <atomic> <cctype> <charconv> <chrono> <cstddef>
+        <cstdint> <cstring> <ctime> <deque> <exception> <filesystem> <functional> <iomanip>
+        <iostream> <iterator> <limits> <list> <map> <memory> <mutex> <optional>
+        <set> <sstream> <stdexcept> <string> <string_view> <thread> <tuple>
+        <type_traits> <unordered_map> <unordered_set> <utility> <variant> <vector>
+    )
+
+    if(ARG_STANDARD_HEADERS)
+        target_precompile_headers(${target} PRIVATE ${_failsafe_std_headers})
+    else()
+        target_precompile_headers(${target} PRIVATE <failsafe/failsafe.hh>)
+    endif()
+endfunction()
@@ -0,0 +1,46 @@
+/**
+ * @file attributes.hh
+ * @brief Portable function attributes and branch hints
+ *
+ * @details
+ * Defines:
+ * - FAILSAFE_NOINLINE: never inline the function
+ * - FAILSAFE_ALWAYS_INLINE: declare the function inline and inline it even
+ *   where the compiler would not, e.g. into cold exception cleanup code
+ * - FAILSAFE_COLD: the function is rarely called; compilers place it away
+ *   from hot code and optimize it for size
+ * - FAILSAFE_LIKELY(x) / FAILSAFE_UNLIKELY(x): branch prediction hints
+ * - FAILSAFE_RETURN_ADDRESS(): the address the current function returns
+ *   to, or nullptr; only meaningful in a function that is not inlined
+ *
+ * Each expands to nothing (or to the plain expression) on compilers that
+ * do not support it.
+ */
+#pragma once
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h> // _ReturnAddress
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define FAILSAFE_NOINLINE __attribute__((noinline))
+    #define FAILSAFE_ALWAYS_INLINE __attribute__((always_inline)) inline
+    #define FAILSAFE_COLD __attribute__((cold))
+    #define FAILSAFE_LIKELY(x) __builtin_expect(!!(x), 1)
+    #define FAILSAFE_UNLIKELY(x) __builtin_expect(!!(x), 0)
+    #define FAILSAFE_RETURN_ADDRESS() __builtin_return_address(0)
+#elif defined(_MSC_VER)
+    #define FAILSAFE_NOINLINE __declspec(noinline)
+    #define FAILSAFE_ALWAYS_INLINE __forceinline
+    #define FAILSAFE_COLD
+    #define FAILSAFE_LIKELY(x) (!!(x))
+    #define FAILSAFE_UNLIKELY(x) (!!(x))
+    #define FAILSAFE_RETURN_ADDRESS() _ReturnAddress()
+#else
+    #define FAILSAFE_NOINLINE
+    #define FAILSAFE_ALWAYS_INLINE inline
+    #define FAILSAFE_COLD
+    #define FAILSAFE_LIKELY(x) (!!(x))
+    #define FAILSAFE_UNLIKELY(x) (!!(x))
+    #define FAILSAFE_RETURN_ADDRESS() nullptr
+#endif
@@ -0,0 +1,70 @@
+/**
+ * @file captured_args-inl.hh
+ * @brief Definitions of the captured_args functions
+ *
+ * @note Included by captured_args.hh in header-only mode and compiled into
+ *       failsafe_impl otherwise, see export.hh.
+ */
+#pragma once
+
+#include <failsafe/detail/captured_args.hh>
+
+#include <vector>
+
+namespace failsafe::detail {
+
+    /**
+     * @brief Copied arguments; string arguments point into `strings`
+     */
+    struct captured_args::state {
+        std::vector <format_arg> args;
+        std::string strings;
+    };
+
+    FAILSAFE_INLINE captured_args::captured_args(format_args args) {
+        if (args.size == 0) {
+            return;
+        }
+        auto captured = std::make_shared <state>();
+        captured->args.assign(args.data, args.data + args.size);
+
+        // Copy strings and render custom arguments into one buffer; the
+        // pointers are set once the buffer no longer grows
+        for (auto& arg : captured->args) {
+            if (arg.type == format_arg::kind::string) {
+                captured->strings.append(arg.string.data, arg.string.size);
+            } else if (arg.type == format_arg::kind::custom) {
+                const std::size_t before = captured->strings.size();
+#if FAILSAFE_FORMAT_ENGINE != FAILSAFE_FORMAT_ENGINE_IOSTREAM
+                arg.custom.render(captured->strings, arg.custom.object);
+#else
+                std::ostringstream oss;
+                arg.custom.render(oss, arg.custom.object);
+                captured->strings += oss.str();
+#endif
+                arg.type = format_arg::kind::string;
+                arg.string = {nullptr, captured->strings.size() - before};
+            }
+        }
+        std::size_t offset = 0;
+        for (auto& arg : captured->args) {
+            if (arg.type == format_arg::kind::string) {
+                arg.string.data = captured->strings.data() + offset;
+                offset += arg.string.size;
+            }
+        }
+        state_ = std::move(captured);
+    }
+
+    FAILSAFE_INLINE format_args captured_args::args() const noexcept {
+        if (!state_) {
+            return {};
+        }
+        return {state_->args.data(), state_->args.size()};
+    }
+
+    FAILSAFE_INLINE std::string captured_args::str() const {
+        return build_message_from_args(args());
+    }
+
+} // namespace failsafe::detail
@@ -0,0 +1,79 @@
+/**
+ * @file captured_args.hh
+ * @brief Owned copy of message arguments, formatted on demand
+ *
+ * @details
+ * A format_arg refers to the caller's argument and must not outlive the
+ * full expression it was created in. captured_args copies the arguments so
+ * that the message can be built later, or never: numbers, booleans and
+ * pointers are kept by value, strings in one shared buffer, and other types
+ * are rendered right away. Copies share the captured arguments.
+ *
+ * Used by lazy_error, failsafe::error and failsafe::status.
+ */
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <failsafe/detail/export.hh>
+#include <failsafe/detail/string_utils.hh>
+
+namespace failsafe::detail {
+
+    /**
+     * @brief Message arguments copied for later formatting
+     */
+    class FAILSAFE_API captured_args {
+        public:
+            /** @brief No arguments */
+            captured_args() noexcept = default;
+
+            /**
+             * @brief Copy type-erased arguments (not a template)
+             */
+            explicit captured_args(format_args args);
+
+            /**
+             * @brief Erase and copy message arguments
+             *
+             * @param args Message arguments, as for build_message()
+             */
+            template<typename... Args>
+            static captured_args capture(Args&&... args) {
+                if constexpr (sizeof...(args) == 0) {
+                    return {};
+                } else {
+                    const format_arg erased[] = {make_format_arg(std::forward <Args>(args))...};
+                    return captured_args(format_args{erased, sizeof...(Args)});
+                }
+            }
+
+            /** @brief Whether no arguments were captured */
+            bool empty() const noexcept {
+                return !state_;
+            }
+
+            /**
+             * @brief The captured arguments; valid as long as this object or
+             *        a copy of it exists
+             */
+            format_args args() const noexcept;
+
+            /**
+             * @brief Build the message, as build_message() would have
+             */
+            std::string str() const;
+
+        private:
+            struct state;
+
+            std::shared_ptr <const state> state_;
+    };
+
+} // namespace failsafe::detail
+
+#ifdef FAILSAFE_HEADER_ONLY
+#include <failsafe/detail/captured_args-inl.hh>
+#endif
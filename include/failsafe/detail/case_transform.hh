@@ -0,0 +1,174 @@
+/**
+ * @file case_transform.hh
+ * @brief In-place upper/lower case conversion of UTF-8 text
+ *
+ * @details
+ * Used by the uppercase()/lowercase() formatters to convert the characters
+ * a value was just rendered to, directly in the output buffer:
+ * - runs of ASCII are converted sixteen bytes per step with SSE2
+ * - two-byte UTF-8 sequences are decoded and mapped for Latin-1, Latin
+ *   Extended-A, Greek and Cyrillic letters
+ *
+ * Conversions whose result would need a different number of bytes (for
+ * example U+00DF to "SS" or U+0131 to 'I') are not applied, and neither
+ * are those outside the scripts above; such characters, as well as
+ * malformed sequences, are left unchanged. Conversion does not depend on
+ * the C or C++ locale.
+ *
+ * Define FAILSAFE_NO_SIMD to force the portable code path.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <failsafe/detail/simd.hh>
+
+namespace failsafe::detail {
+
+    /**
+     * @brief Direction of a case conversion
+     */
+    enum class letter_case {
+        upper, ///< Convert to upper case
+        lower ///< Convert to lower case
+    };
+
+    /**
+     * @internal
+     * @brief Upper case of a code point in U+0080..U+07FF
+     *
+     * @return The mapped code point, or cp if it has no two-byte upper case
+     */
+    constexpr std::uint32_t to_upper_two_byte(std::uint32_t cp) noexcept {
+        // Latin-1 Supplement
+        if (cp >= 0xE0 && cp <= 0xFE && cp != 0xF7) return cp - 0x20;
+        if (cp == 0xFF) return 0x178;
+        // Latin Extended-A
+        if ((cp >= 0x100 && cp <= 0x12F) || (cp >= 0x132 && cp <= 0x137) || (cp >= 0x14A && cp <= 0x177)) {
+            return cp & ~std::uint32_t{1};
+        }
+        if ((cp >= 0x139 && cp <= 0x148) || (cp >= 0x179 && cp <= 0x17E)) {
+            return (cp & 1) == 0 ? cp - 1 : cp;
+        }
+        // Greek
+        if (cp == 0x3AC) return 0x386;
+        if (cp >= 0x3AD && cp <= 0x3AF) return cp - 0x25;
+        if (cp >= 0x3B1 && cp <= 0x3CB) return cp == 0x3C2 ? 0x3A3 : cp - 0x20;
+        if (cp == 0x3CC) return 0x38C;
+        if (cp == 0x3CD || cp == 0x3CE) return cp - 0x3F;
+        // Cyrillic
+        if (cp >= 0x430 && cp <= 0x44F) return cp - 0x20;
+        if (cp >= 0x450 && cp <= 0x45F) return cp - 0x50;
+        if ((cp >= 0x460 && cp <= 0x481) || (cp >= 0x48A && cp <= 0x4BF)) {
+            return cp & ~std::uint32_t{1};
+        }
+        return cp;
+    }
+
+    /**
+     * @internal
+     * @brief Lower case of a code point in U+0080..U+07FF
+     *
+     * @return The mapped code point, or cp if it has no two-byte lower case
+     */
+    constexpr std::uint32_t to_lower_two_byte(std::uint32_t cp) noexcept {
+        // Latin-1 Supplement
+        if (cp >= 0xC0 && cp <= 0xDE && cp != 0xD7) return cp + 0x20;
+        if (cp == 0x178) return 0xFF;
+        // Latin Extended-A
+        if ((cp >= 0x100 && cp <= 0x12F) || (cp >= 0x132 && cp <= 0x137) || (cp >= 0x14A && cp <= 0x177)) {
+            return cp | 1;
+        }
+        if ((cp >= 0x139 && cp <= 0x148) || (cp >= 0x179 && cp <= 0x17E)) {
+            return (cp & 1) != 0 ? cp + 1 : cp;
+        }
+        // Greek
+        if (cp == 0x386) return 0x3AC;
+        if (cp >= 0x388 && cp <= 0x38A) return cp + 0x25;
+        if (cp == 0x38C) return 0x3CC;
+        if (cp == 0x38E || cp == 0x38F) return cp + 0x3F;
+        if (cp >= 0x391 && cp <= 0x3AB && cp != 0x3A2) return cp + 0x20;
+        // Cyrillic
+        if (cp >= 0x410 && cp <= 0x42F) return cp + 0x20;
+        if (cp >= 0x400 && cp <= 0x40F) return cp + 0x50;
+        if ((cp >= 0x460 && cp <= 0x481) || (cp >= 0x48A && cp <= 0x4BF)) {
+            return cp | 1;
+        }
+        return cp;
+    }
+
+    /**
+     * @internal
+     * @brief Convert the character starting at data[i]
+     *
+     * @return Index of the next character
+     */
+    template<letter_case Case>
+    std::size_t transform_case_step(char* data, std::size_t size, std::size_t i) noexcept {
+        const auto c = static_cast<unsigned char>(data[i]);
+        if (c < 0x80) {
+            if constexpr (Case == letter_case::upper) {
+                if (c >= 'a' && c <= 'z') data[i] = static_cast<char>(c - 0x20);
+            } else {
+                if (c >= 'A' && c <= 'Z') data[i] = static_cast<char>(c + 0x20);
+            }
+            return i + 1;
+        }
+        // Only two-byte sequences hold mappable letters; continuation bytes
+        // and longer sequences are stepped over a byte at a time
+        if ((c & 0xE0) != 0xC0 || i + 1 >= size) {
+            return i + 1;
+        }
+        const auto next = static_cast<unsigned char>(data[i + 1]);
+        if ((next & 0xC0) != 0x80) {
+            return i + 1;
+        }
+        const std::uint32_t cp = (std::uint32_t{c & 0x1Fu} << 6) | (next & 0x3Fu);
+        const std::uint32_t mapped = Case == letter_case::upper ? to_upper_two_byte(cp) : to_lower_two_byte(cp);
+        if (mapped != cp) {
+            data[i] = static_cast<char>(0xC0 | (mapped >> 6));
+            data[i + 1] = static_cast<char>(0x80 | (mapped & 0x3F));
+        }
+        return i + 2;
+    }
+
+    /**
+     * @brief Convert UTF-8 text to upper or lower case in place
+     *
+     * @tparam Case Conversion direction
+     * @param data Text to convert
+     * @param size Number of bytes
+     */
+    template<letter_case Case>
+    void transform_case(char* data, std::size_t size) noexcept {
+        std::size_t i = 0;
+#if FAILSAFE_HAS_SSE2
+        constexpr char first = Case == letter_case::upper ? 'a' : 'A';
+        constexpr char last = Case == letter_case::upper ? 'z' : 'Z';
+        const __m128i below = _mm_set1_epi8(first - 1);
+        const __m128i above = _mm_set1_epi8(last + 1);
+        const __m128i flip = _mm_set1_epi8(0x20);
+        while (size - i >= 16) {
+            auto* block = reinterpret_cast<__m128i*>(data + i);
+            const __m128i v = _mm_loadu_si128(block);
+            if (_mm_movemask_epi8(v) != 0) {
+                // Non-ASCII bytes: convert this block character by character
+                const std::size_t end = i + 16;
+                while (i < end) {
+                    i = transform_case_step<Case>(data, size, i);
+                }
+                continue;
+            }
+            // Signed compares: all bytes are below 0x80 here
+            const __m128i in_range = _mm_and_si128(_mm_cmpgt_epi8(v, below), _mm_cmplt_epi8(v, above));
+            _mm_storeu_si128(block, _mm_xor_si128(v, _mm_and_si128(in_range, flip)));
+            i += 16;
+        }
+#endif
+        while (i < size) {
+            i = transform_case_step<Case>(data, size, i);
+        }
+    }
+
+} // namespace failsafe::detail
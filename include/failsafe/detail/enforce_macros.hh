@@ -0,0 +1,281 @@
+/**
+ * @file enforce_macros.hh
+ * @brief ENFORCE* macros
+ *
+ * @details
+ * Preprocessor definitions only. Included by enforce.hh, and by macros.hh
+ * for translation units that use `import failsafe;`.
+ */
+#pragma once
+
+#include <failsafe/detail/result_macros.hh>
+
+/**
+ * @defgroup EnforceMacros Enforcement Macros
+ * @{
+ */
+
+/**
+ * @brief Main enforcement macro
+ * 
+ * Validates expression and returns the value if true.
+ * Throws FAILSAFE_DEFAULT_EXCEPTION on failure.
+ * 
+ * @param expr Expression to enforce
+ * @return The value of expr if validation passes
+ * 
+ * @example
+ * @code
+ * auto ptr = ENFORCE(malloc(size));  // Throws on null
+ * auto file = ENFORCE(fopen(path, "r"))("Failed to open:", path);
+ * @endcode
+ */
+#define ENFORCE(expr) \
+    ::failsafe::enforce::make_enforcer((expr), #expr, __FILE__, __LINE__)
+
+/**
+ * @brief Enforce with specific exception type
+ * 
+ * @param expr Expression to enforce
+ * @param ExceptionType Exception type to throw on failure
+ */
+#define ENFORCE_THROW(expr, ExceptionType) \
+    ::failsafe::enforce::make_enforcer_throw<ExceptionType>((expr), #expr, __FILE__, __LINE__)
+
+/**
+ * @brief Enforce that always traps to debugger
+ * 
+ * @param expr Expression to enforce
+ */
+#define ENFORCE_TRAP(expr) \
+    ::failsafe::enforce::make_enforcer_trap((expr), #expr, __FILE__, __LINE__)
+
+/** @} */ // end of EnforceMacros group
+
+/**
+ * @defgroup ComparisonMacros Comparison Enforcement Macros
+ * @{
+ */
+
+/** @brief Enforce equality */
+#define ENFORCE_EQ(value, expected) \
+    ::failsafe::enforce::enforce_eq((value), (expected), #value " == " #expected, __FILE__, __LINE__)
+
+/** @brief Enforce inequality */
+#define ENFORCE_NE(value, expected) \
+    ::failsafe::enforce::enforce_ne((value), (expected), #value " != " #expected, __FILE__, __LINE__)
+
+/** @brief Enforce less than */
+#define ENFORCE_LT(value, bound) \
+    ::failsafe::enforce::enforce_lt((value), (bound), #value " < " #bound, __FILE__, __LINE__)
+
+/** @brief Enforce greater than */
+#define ENFORCE_GT(value, bound) \
+    ::failsafe::enforce::enforce_gt((value), (bound), #value " > " #bound, __FILE__, __LINE__)
+
+/** @brief Enforce less than or equal */
+#define ENFORCE_LE(value, bound) \
+    ENFORCE((value) <= (bound))
+
+/** @brief Enforce greater than or equal */
+#define ENFORCE_GE(value, bound) \
+    ENFORCE((value) >= (bound))
+
+/** @brief Enforce value in range [lower, upper] */
+#define ENFORCE_IN_RANGE(value, lower, upper) \
+    ::failsafe::enforce::enforce_in_range((value), (lower), (upper), \
+        #value " in [" #lower ", " #upper "]", __FILE__, __LINE__)
+
+/** @} */ // end of ComparisonMacros group
+
+/**
+ * @defgroup SpecializedMacros Specialized Enforcement Macros
+ * @{
+ */
+
+/**
+ * @brief Enforce non-null pointer
+ * 
+ * @param ptr Pointer to check
+ * @example
+ * @code
+ * auto buffer = ENFORCE_NOT_NULL(malloc(size));
+ * @endcode
+ */
+#define ENFORCE_NOT_NULL(ptr) \
+    ENFORCE(ptr)("Null pointer: " #ptr)
+
+/**
+ * @brief Enforce valid array index
+ * 
+ * @param index Index to validate
+ * @param size Array size
+ * 
+ * For unsigned types, only checks upper bound. For signed types, checks both bounds.
+ */
+#define ENFORCE_VALID_INDEX(index, size) \
+    ENFORCE(::failsafe::detail::is_valid_index(index, size))("Index out of bounds: ", (index), " not in [0, ", (size), ")")
+
+/**
+ * @brief Debug-only enforcement
+ * 
+ * Like assert() but with better error messages.
+ * Compiled out in release builds.
+ * 
+ * @param expr Expression to enforce in debug builds
+ */
+#ifdef NDEBUG
+    #define DEBUG_ENFORCE(expr) ((void)0)
+#else
+    #define DEBUG_ENFORCE(expr) ENFORCE_TRAP(expr)
+#endif
+
+/** @} */ // end of SpecializedMacros group
+
+/**
+ * @defgroup BulkMacros Bulk Enforcement Macros
+ * @brief Check every element of a range; see enforce_all()
+ *
+ * Each macro evaluates to the range. On failure the exception reports the
+ * index and value of the first offending element.
+ * @{
+ */
+
+/**
+ * @brief Enforce that every element is true (e.g. all pointers non-null)
+ *
+ * @param range Range to check
+ */
+#define ENFORCE_ALL(range) \
+    ::failsafe::enforce::enforce_all((range), ::failsafe::enforce::predicates::truth{}, \
+        "all of " #range, __FILE__, __LINE__)
+
+/**
+ * @brief Enforce that every element is in [lower, upper]
+ *
+ * @example
+ * @code
+ * ENFORCE_ALL_IN_RANGE(samples, -1.0f, 1.0f);
+ * @endcode
+ */
+#define ENFORCE_ALL_IN_RANGE(range, lower, upper) \
+    ::failsafe::enforce::enforce_all_in_range((range), (lower), (upper), \
+        "all of " #range " in [" #lower ", " #upper "]", __FILE__, __LINE__)
+
+/**
+ * @brief Enforce that every element is a valid index for size
+ *
+ * For unsigned types, only checks upper bound. For signed types, checks both bounds.
+ */
+#define ENFORCE_ALL_VALID_INDEX(range, size) \
+    ::failsafe::enforce::enforce_all_valid_index((range), (size), \
+        "all of " #range " in [0, " #size ")", __FILE__, __LINE__)
+
+/**
+ * @brief Enforce that no element is NaN
+ */
+#define ENFORCE_ALL_NOT_NAN(range) \
+    ::failsafe::enforce::enforce_all((range), ::failsafe::enforce::predicates::not_nan{}, \
+        "all of " #range, __FILE__, __LINE__)
+
+/** @} */ // end of BulkMacros group
+
+/**
+ * @defgroup ConstexprMacros Compile-Time Enforcement Macros
+ * @brief Checks that fail the build when evaluated in a constant expression
+ *
+ * Usable in constexpr functions; see enforce_constexpr(). Each macro
+ * evaluates to the checked value. At run time a failure throws
+ * FAILSAFE_DEFAULT_EXCEPTION.
+ *
+ * @example
+ * @code
+ * constexpr Layout make_layout(std::size_t header, std::size_t total) {
+ *     ENFORCE_CONSTEXPR_LE(header, total);
+ *     return Layout{header, ENFORCE_CONSTEXPR(total - header)};
+ * }
+ * @endcode
+ * @{
+ */
+
+/** @brief Enforce that expr is true (non-null, non-zero) */
+#define ENFORCE_CONSTEXPR(expr) \
+    ::failsafe::enforce::enforce_constexpr((expr), ::failsafe::enforce::predicates::truth{}, \
+        #expr, __FILE__, __LINE__)
+
+/** @brief Enforce equality at compile time */
+#define ENFORCE_CONSTEXPR_EQ(value, expected) \
+    ::failsafe::enforce::enforce_constexpr_eq((value), (expected), #value " == " #expected, __FILE__, __LINE__)
+
+/** @brief Enforce inequality at compile time */
+#define ENFORCE_CONSTEXPR_NE(value, expected) \
+    ::failsafe::enforce::enforce_constexpr_ne((value), (expected), #value " != " #expected, __FILE__, __LINE__)
+
+/** @brief Enforce less than at compile time */
+#define ENFORCE_CONSTEXPR_LT(value, bound) \
+    ::failsafe::enforce::enforce_constexpr_lt((value), (bound), #value " < " #bound, __FILE__, __LINE__)
+
+/** @brief Enforce greater than at compile time */
+#define ENFORCE_CONSTEXPR_GT(value, bound) \
+    ::failsafe::enforce::enforce_constexpr_gt((value), (bound), #value " > " #bound, __FILE__, __LINE__)
+
+/** @brief Enforce less than or equal at compile time */
+#define ENFORCE_CONSTEXPR_LE(value, bound) \
+    ::failsafe::enforce::enforce_constexpr_le((value), (bound), #value " <= " #bound, __FILE__, __LINE__)
+
+/** @brief Enforce greater than or equal at compile time */
+#define ENFORCE_CONSTEXPR_GE(value, bound) \
+    ::failsafe::enforce::enforce_constexpr_ge((value), (bound), #value " >= " #bound, __FILE__, __LINE__)
+
+/** @brief Enforce value in range [lower, upper] at compile time */
+#define ENFORCE_CONSTEXPR_IN_RANGE(value, lower, upper) \
+    ::failsafe::enforce::enforce_constexpr_in_range((value), (lower), (upper), \
+        #value " in [" #lower ", " #upper "]", __FILE__, __LINE__)
+
+/** @} */ // end of ConstexprMacros group
+
+/**
+ * @defgroup ResultMacros Enforcement Macros Returning Results
+ * @brief Checks that return a failsafe::result instead of raising
+ *
+ * Each macro evaluates to a failsafe::result holding the checked value or
+ * the error; see enforce_result(). A custom message is chained like with
+ * ENFORCE and only copied for a failed check. Usable with -fno-exceptions.
+ *
+ * @example
+ * @code
+ * failsafe::result<connection*> pick(std::size_t index) {
+ *     ASSIGN_OR_PROPAGATE(std::size_t i, ENFORCE_RESULT_LT(index, pool.size()));
+ *     return ENFORCE_RESULT(pool[i].get())("Connection", i, "is closed");
+ * }
+ * @endcode
+ * @{
+ */
+
+/** @brief Check that expr is true (non-null, non-zero) */
+#define ENFORCE_RESULT(expr) \
+    ::failsafe::enforce::enforce_result((expr), ::failsafe::enforce::predicates::truth{}, \
+        FAILSAFE_ERROR_SITE(#expr))
+
+/** @brief Check equality */
+#define ENFORCE_RESULT_EQ(value, expected) \
+    ::failsafe::enforce::enforce_result_eq((value), (expected), FAILSAFE_ERROR_SITE(#value " == " #expected))
+
+/** @brief Check inequality */
+#define ENFORCE_RESULT_NE(value, expected) \
+    ::failsafe::enforce::enforce_result_ne((value), (expected), FAILSAFE_ERROR_SITE(#value " != " #expected))
+
+/** @brief Check less than */
+#define ENFORCE_RESULT_LT(value, bound) \
+    ::failsafe::enforce::enforce_result_lt((value), (bound), FAILSAFE_ERROR_SITE(#value " < " #bound))
+
+/** @brief Check greater than */
+#define ENFORCE_RESULT_GT(value, bound) \
+    ::failsafe::enforce::enforce_result_gt((value), (bound), FAILSAFE_ERROR_SITE(#value " > " #bound))
+
+/** @brief Check value in range [lower, upper] */
+#define ENFORCE_RESULT_IN_RANGE(value, lower, upper) \
+    ::failsafe::enforce::enforce_result_in_range((value), (lower), (upper), \
+        FAILSAFE_ERROR_SITE(#value " in [" #lower ", " #upper "]"))
+
+/** @} */ // end of ResultMacros group
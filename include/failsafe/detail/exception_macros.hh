@@ -0,0 +1,189 @@
+/**
+ * @file exception_macros.hh
+ * @brief THROW*, TRAP* macros and the default exception type
+ *
+ * @details
+ * Preprocessor definitions only. Included by exception.hh, and by macros.hh
+ * for translation units that use `import failsafe;`.
+ *
+ * The macros only pass the source location and the arguments to out of line
+ * cold functions, which build the message; conditions are marked unlikely.
+ * A THROW_IF or TRAP_IF that does not fire costs the test and a branch.
+ */
+#pragma once
+
+#include <exception>
+#include <stdexcept>
+
+#include <failsafe/detail/attributes.hh>
+#include <failsafe/detail/psnip_debug_trap.h>
+
+/**
+ * @brief Default exception type for THROW_DEFAULT macro
+ * 
+ * Can be overridden by defining before including this header.
+ * Default is std::runtime_error.
+ */
+#ifndef FAILSAFE_DEFAULT_EXCEPTION
+#define FAILSAFE_DEFAULT_EXCEPTION std::runtime_error
+#endif
+
+/**
+ * @defgroup ExceptionMacros Exception Throwing Macros
+ * @{
+ */
+
+/**
+ * @brief Throw an exception with specified type and formatted message
+ * 
+ * @param ExceptionType The exception class to throw
+ * @param ... Variable arguments for message formatting
+ * 
+ * @example
+ * @code
+ * THROW(std::runtime_error, "Operation failed with code:", error_code);
+ * @endcode
+ */
+#define THROW(ExceptionType, ...) \
+    ::failsafe::exception::internal::throw_exception< ExceptionType >( \
+        __FILE__, __LINE__, __VA_ARGS__)
+
+/**
+ * @brief Throw the default exception type with formatted message
+ * 
+ * Uses FAILSAFE_DEFAULT_EXCEPTION (default: std::runtime_error)
+ * 
+ * @param ... Variable arguments for message formatting
+ */
+#define THROW_DEFAULT(...) \
+    THROW(FAILSAFE_DEFAULT_EXCEPTION, __VA_ARGS__)
+
+/**
+ * @brief Conditionally throw an exception
+ * 
+ * @param condition Boolean condition to check
+ * @param ExceptionType The exception class to throw
+ * @param ... Variable arguments for message formatting
+ */
+#define THROW_IF(condition, ExceptionType, ...) \
+    do { \
+        if (FAILSAFE_UNLIKELY(condition)) { \
+            THROW(ExceptionType, __VA_ARGS__); \
+        } \
+    } while(0)
+
+/**
+ * @brief Conditionally throw the default exception type
+ * 
+ * @param condition Boolean condition to check
+ * @param ... Variable arguments for message formatting
+ */
+#define THROW_DEFAULT_IF(condition, ...) \
+    THROW_IF(condition, FAILSAFE_DEFAULT_EXCEPTION, __VA_ARGS__)
+
+/**
+ * @brief Throw exception unless condition is true (assert-like)
+ * 
+ * @param condition Boolean condition that must be true
+ * @param ExceptionType The exception class to throw if false
+ * @param ... Variable arguments for message formatting
+ */
+#define THROW_UNLESS(condition, ExceptionType, ...) \
+    THROW_IF(!(condition), ExceptionType, __VA_ARGS__)
+
+/**
+ * @brief Throw default exception unless condition is true
+ * 
+ * @param condition Boolean condition that must be true
+ * @param ... Variable arguments for message formatting
+ */
+#define THROW_DEFAULT_UNLESS(condition, ...) \
+    THROW_UNLESS(condition, FAILSAFE_DEFAULT_EXCEPTION, __VA_ARGS__)
+
+/** @} */ // end of ExceptionMacros group
+
+/**
+ * @defgroup ConvenienceMacros Convenience Exception Macros
+ * @{
+ */
+
+/** @brief Throw std::runtime_error */
+#define THROW_RUNTIME(...) THROW(std::runtime_error, __VA_ARGS__)
+
+/** @brief Throw std::logic_error */
+#define THROW_LOGIC(...) THROW(std::logic_error, __VA_ARGS__)
+
+/** @brief Throw std::invalid_argument */
+#define THROW_INVALID_ARG(...) THROW(std::invalid_argument, __VA_ARGS__)
+
+/** @brief Throw std::out_of_range */
+#define THROW_OUT_OF_RANGE(...) THROW(std::out_of_range, __VA_ARGS__)
+
+/** @brief Throw std::length_error */
+#define THROW_LENGTH(...) THROW(std::length_error, __VA_ARGS__)
+
+/** @brief Throw std::domain_error */
+#define THROW_DOMAIN(...) THROW(std::domain_error, __VA_ARGS__)
+
+/** @} */ // end of ConvenienceMacros group
+
+/**
+ * @defgroup TrapMacros Debug Trap Macros
+ * @brief Direct control over debug trap behavior
+ * @{
+ */
+
+/**
+ * @brief Always trap to debugger (no throw)
+ * 
+ * Prints exception info and traps to debugger.
+ * Never returns - calls std::terminate() after trap.
+ * The trap is raised in an out of line function; the TRAP site is one
+ * frame up in the debugger.
+ * 
+ * @param ... Variable arguments for message formatting
+ */
+#define TRAP(...) \
+    ::failsafe::exception::internal::trap_site{__FILE__, __LINE__}(__VA_ARGS__)
+
+/**
+ * @brief Conditionally trap to debugger
+ * 
+ * @param condition Boolean condition to check
+ * @param ... Variable arguments for message formatting
+ */
+#define TRAP_IF(condition, ...) \
+    do { \
+        if (FAILSAFE_UNLIKELY(condition)) { \
+            TRAP(__VA_ARGS__); \
+        } \
+    } while(0)
+
+/**
+ * @brief Trap unless condition is true (assert-like)
+ * 
+ * @param condition Boolean condition that must be true
+ * @param ... Variable arguments for message formatting
+ */
+#define TRAP_UNLESS(condition, ...) \
+    TRAP_IF(!(condition), __VA_ARGS__)
+
+/**
+ * @brief Trap in debug builds, throw in release builds
+ * 
+ * Provides different behavior based on NDEBUG:
+ * - Debug builds: Trap to debugger
+ * - Release builds: Throw exception
+ * 
+ * @param ExceptionType The exception class to throw in release
+ * @param ... Variable arguments for message formatting
+ */
+#ifdef NDEBUG
+    #define DEBUG_TRAP_RELEASE_THROW(ExceptionType, ...) \
+        THROW(ExceptionType, __VA_ARGS__)
+#else
+#define DEBUG_TRAP_RELEASE_THROW(ExceptionType, ...) \
+        TRAP(__VA_ARGS__)
+#endif
+
+/** @} */ // end of TrapMacros group
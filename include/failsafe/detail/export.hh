@@ -0,0 +1,46 @@
+/**
+ * @file export.hh
+ * @brief Header-only and precompiled library modes
+ *
+ * @details
+ * By default failsafe is header-only. Functions that are not templates can
+ * instead be compiled once into the failsafe_impl library (CMake option
+ * NEUTRINO_FAILSAFE_BUILD_IMPL); its consumers get FAILSAFE_COMPILED_LIB
+ * defined and only parse declarations of those functions. Their definitions
+ * live in *-inl.hh headers, which are included by the declaring header in
+ * header-only mode and by src/failsafe.cc when building the library.
+ *
+ * Configuration macros that affect these functions (FAILSAFE_FORMAT_ENGINE,
+ * FAILSAFE_LOCATION_FORMAT_STYLE, FAILSAFE_LOCATION_PATH_STYLE) are fixed
+ * when the library is built and must not be changed by its consumers.
+ *
+ * Defines:
+ * - FAILSAFE_HEADER_ONLY: defined unless FAILSAFE_COMPILED_LIB is defined
+ * - FAILSAFE_INLINE: `inline` in header-only mode, empty otherwise
+ * - FAILSAFE_API: symbol export/import for a shared failsafe_impl
+ *   (FAILSAFE_SHARED_LIB), empty otherwise
+ */
+#pragma once
+
+#if defined(FAILSAFE_COMPILED_LIB)
+    #undef FAILSAFE_HEADER_ONLY
+    #define FAILSAFE_INLINE
+    #if defined(FAILSAFE_SHARED_LIB)
+        #if defined(_WIN32)
+            #if defined(FAILSAFE_BUILDING_LIB)
+                #define FAILSAFE_API __declspec(dllexport)
+            #else
+                #define FAILSAFE_API __declspec(dllimport)
+            #endif
+        #else
+            // Standard attribute syntax: also valid after `class [[nodiscard]]`
+            #define FAILSAFE_API [[gnu::visibility("default")]]
+        #endif
+    #else
+        #define FAILSAFE_API
+    #endif
+#else
+    #define FAILSAFE_HEADER_ONLY
+    #define FAILSAFE_INLINE inline
+    #define FAILSAFE_API
+#endif
@@ -0,0 +1,33 @@
+/**
+ * @file features.hh
+ * @brief Language feature detection
+ *
+ * @details
+ * Defines, to 1 or 0:
+ * - FAILSAFE_HAS_CONCEPTS: C++20 concepts, ranges and std::span
+ * - FAILSAFE_HAS_FORMAT_STRING: compile-time checked format strings, see
+ *   format_string.hh
+ * - FAILSAFE_HAS_EXCEPTIONS: exceptions are enabled (not -fno-exceptions,
+ *   or /EHsc with MSVC)
+ *
+ * Only preprocessor definitions, so that macros.hh can use it.
+ */
+#pragma once
+
+#if __cplusplus >= 202002L
+    #define FAILSAFE_HAS_CONCEPTS 1
+#else
+    #define FAILSAFE_HAS_CONCEPTS 0
+#endif
+
+#if defined(__cpp_consteval) && __cpp_consteval >= 201811L && FAILSAFE_HAS_CONCEPTS
+    #define FAILSAFE_HAS_FORMAT_STRING 1
+#else
+    #define FAILSAFE_HAS_FORMAT_STRING 0
+#endif
+
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    #define FAILSAFE_HAS_EXCEPTIONS 1
+#else
+    #define FAILSAFE_HAS_EXCEPTIONS 0
+#endif
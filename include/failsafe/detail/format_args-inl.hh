@@ -0,0 +1,79 @@
+/**
+ * @file format_args-inl.hh
+ * @brief Definitions of the type-erased message building functions
+ *
+ * @note Included by format_args.hh in header-only mode and compiled into
+ *       failsafe_impl otherwise, see export.hh.
+ */
+#pragma once
+
+#include <failsafe/detail/string_utils.hh>
+
+namespace failsafe::detail {
+
+    FAILSAFE_INLINE void render_format_arg(message_sink& out, const format_arg& arg) {
+        switch (arg.type) {
+            case format_arg::kind::boolean:
+                sink_write(out, arg.boolean ? "true" : "false");
+                break;
+            case format_arg::kind::string:
+                sink_write(out, std::string_view(arg.string.data, arg.string.size));
+                break;
+            case format_arg::kind::custom:
+                arg.custom.render(out, arg.custom.object);
+                break;
+#if FAILSAFE_FORMAT_ENGINE != FAILSAFE_FORMAT_ENGINE_IOSTREAM
+            case format_arg::kind::signed_integer:
+                append_to_buffer(out, arg.signed_integer);
+                break;
+            case format_arg::kind::unsigned_integer:
+                append_to_buffer(out, arg.unsigned_integer);
+                break;
+            case format_arg::kind::floating:
+                append_to_buffer(out, arg.floating);
+                break;
+            case format_arg::kind::pointer:
+                append_to_buffer(out, arg.pointer);
+                break;
+#else
+            case format_arg::kind::signed_integer:
+                out << arg.signed_integer;
+                break;
+            case format_arg::kind::unsigned_integer:
+                out << arg.unsigned_integer;
+                break;
+            case format_arg::kind::floating:
+                out << arg.floating;
+                break;
+            case format_arg::kind::pointer:
+                if (arg.pointer == nullptr) {
+                    sink_write(out, "nullptr");
+                } else {
+                    out << arg.pointer;
+                }
+                break;
+#endif
+        }
+    }
+
+    FAILSAFE_INLINE FAILSAFE_NOINLINE std::string build_message_from_args(format_args args) {
+#if FAILSAFE_FORMAT_ENGINE != FAILSAFE_FORMAT_ENGINE_IOSTREAM
+        message_buffer_lease lease;
+        std::string& out = lease.get();
+#else
+        std::ostringstream out;
+#endif
+        for (std::size_t i = 0; i < args.size; ++i) {
+            if (i != 0) {
+                sink_write(out, " ");
+            }
+            render_format_arg(out, args.data[i]);
+        }
+#if FAILSAFE_FORMAT_ENGINE != FAILSAFE_FORMAT_ENGINE_IOSTREAM
+        return std::string(out);
+#else
+        return out.str();
+#endif
+    }
+
+} // namespace failsafe::detail
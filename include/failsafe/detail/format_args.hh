@@ -0,0 +1,212 @@
+/**
+ * @file format_args.hh
+ * @brief Type-erased message arguments
+ *
+ * @details
+ * build_message() converts its arguments into an array of format_arg and
+ * passes it to the non-template build_message_from_args(), so the code that
+ * joins and renders arguments exists once per program instead of once per
+ * argument combination:
+ * - booleans, integers, float/double, narrow strings and object pointers are
+ *   stored by value and rendered by build_message_from_args() itself
+ * - every other type is stored as an address plus a render callback, which
+ *   is instantiated once per type and calls append_to_stream() (or
+ *   append_to_buffer() with a format engine)
+ *
+ * A format_arg refers to the caller's argument; it must not outlive the
+ * full expression it was created in.
+ *
+ * @note This header is included by string_utils.hh; do not include it directly.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <failsafe/detail/attributes.hh>
+#include <failsafe/detail/export.hh>
+
+namespace failsafe::detail {
+
+    /**
+     * @brief Destination the selected format engine renders into
+     */
+#if FAILSAFE_FORMAT_ENGINE != FAILSAFE_FORMAT_ENGINE_IOSTREAM
+    using message_sink = std::string;
+#else
+    using message_sink = std::ostringstream;
+#endif
+
+    /**
+     * @brief A single type-erased message argument
+     */
+    struct format_arg {
+        /**
+         * @brief Kind of stored value
+         */
+        enum class kind : unsigned char {
+            boolean, ///< bool
+            signed_integer, ///< Signed integers, not character types
+            unsigned_integer, ///< Unsigned integers, not character types
+            floating, ///< float and double
+            string, ///< Narrow strings (a null char pointer is stored as "nullptr")
+            pointer, ///< Pointers to non-character objects and void
+            custom ///< Anything else, rendered through a callback
+        };
+
+        /** @brief Callback rendering a custom argument */
+        using render_function = void (*)(message_sink& out, const volatile void* object);
+
+        /** @brief String argument (std::string_view is not trivially constructible) */
+        struct string_value {
+            const char* data;
+            std::size_t size;
+        };
+
+        /** @brief Custom argument: address and renderer */
+        struct custom_value {
+            const volatile void* object;
+            render_function render;
+        };
+
+        kind type;
+        union {
+            bool boolean;
+            long long signed_integer;
+            unsigned long long unsigned_integer;
+            double floating;
+            string_value string;
+            const void* pointer;
+            custom_value custom;
+        };
+    };
+
+    /**
+     * @brief Non-owning view of an argument array
+     */
+    struct format_args {
+        const format_arg* data = nullptr;
+        std::size_t size = 0;
+    };
+
+    /**
+     * @internal
+     * @brief Character types, printed as characters or strings by operator<<
+     */
+    template<typename T>
+    inline constexpr bool is_character_v =
+        std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char> ||
+        std::is_same_v<T, wchar_t> || std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t>
+#if defined(__cpp_char8_t)
+        || std::is_same_v<T, char8_t>
+#endif
+        ;
+
+    /**
+     * @internal
+     * @brief Integers stored by value (no bool, no character types)
+     */
+    template<typename T>
+    inline constexpr bool is_erased_integer_v =
+        std::is_integral_v<T> && !std::is_same_v<T, bool> && !is_character_v<T> &&
+        sizeof(T) <= sizeof(long long);
+
+    /**
+     * @internal
+     * @brief Pointers rendered as addresses by operator<<
+     */
+    template<typename T>
+    inline constexpr bool is_erased_pointer_v = [] {
+        if constexpr (std::is_pointer_v<T>) {
+            using Pointee = std::remove_pointer_t<T>;
+            return (std::is_void_v<Pointee> || std::is_object_v<Pointee>) &&
+                   !std::is_volatile_v<Pointee> && !is_character_v<std::remove_cv_t<Pointee>>;
+        } else {
+            return false;
+        }
+    }();
+
+    /**
+     * @internal
+     * @brief Render a custom argument with the regular formatting rules
+     *
+     * @tparam T The argument type as forwarded to build_message()
+     */
+    template<typename T>
+    void render_custom_arg(message_sink& out, const volatile void* object) {
+        using Object = std::remove_reference_t<T>;
+        auto& value = *const_cast<Object*>(static_cast<const volatile Object*>(object));
+#if FAILSAFE_FORMAT_ENGINE != FAILSAFE_FORMAT_ENGINE_IOSTREAM
+        append_to_buffer(out, value);
+#else
+        append_to_stream(out, static_cast<T&&>(value));
+#endif
+    }
+
+    /**
+     * @brief Erase the type of a message argument
+     *
+     * @param value The argument; must outlive the returned format_arg
+     */
+    template<typename T>
+    format_arg make_format_arg(T&& value) noexcept {
+        using DecayT = std::decay_t<T>;
+        format_arg arg;
+        if constexpr (std::is_same_v<DecayT, bool>) {
+            arg.type = format_arg::kind::boolean;
+            arg.boolean = value;
+        } else if constexpr (is_erased_integer_v<DecayT> && std::is_signed_v<DecayT>) {
+            arg.type = format_arg::kind::signed_integer;
+            arg.signed_integer = value;
+        } else if constexpr (is_erased_integer_v<DecayT>) {
+            arg.type = format_arg::kind::unsigned_integer;
+            arg.unsigned_integer = value;
+        } else if constexpr (std::is_same_v<DecayT, float> || std::is_same_v<DecayT, double>) {
+            // operator<< and the format engines render float as double
+            arg.type = format_arg::kind::floating;
+            arg.floating = value;
+        } else if constexpr (std::is_same_v<DecayT, std::string> || std::is_same_v<DecayT, std::string_view>) {
+            arg.type = format_arg::kind::string;
+            arg.string = {value.data(), value.size()};
+        } else if constexpr (std::is_array_v<std::remove_reference_t<T>> &&
+                             std::is_same_v<std::remove_cv_t<std::remove_extent_t<std::remove_reference_t<T>>>, char>) {
+            // Character arrays print up to the terminator, like operator<<
+            arg.type = format_arg::kind::string;
+            arg.string = {value, std::strlen(value)};
+        } else if constexpr (std::is_same_v<DecayT, const char*> || std::is_same_v<DecayT, char*>) {
+            arg.type = format_arg::kind::string;
+            const char* text = value != nullptr ? value : "nullptr";
+            arg.string = {text, std::strlen(text)};
+        } else if constexpr (is_erased_pointer_v<DecayT> && !std::is_array_v<std::remove_reference_t<T>>) {
+            arg.type = format_arg::kind::pointer;
+            arg.pointer = static_cast<const void*>(value);
+        } else {
+            arg.type = format_arg::kind::custom;
+            arg.custom = {static_cast<const volatile void*>(std::addressof(value)), &render_custom_arg<T>};
+        }
+        return arg;
+    }
+
+    /**
+     * @brief Render a single type-erased argument
+     */
+    FAILSAFE_API void render_format_arg(message_sink& out, const format_arg& arg);
+
+    /**
+     * @brief Build a message string from type-erased arguments
+     *
+     * Arguments are joined with single spaces. Not a template, so all
+     * build_message() calls share this code.
+     */
+    FAILSAFE_API std::string build_message_from_args(format_args args);
+
+} // namespace failsafe::detail
+
+#ifdef FAILSAFE_HEADER_ONLY
+#include <failsafe/detail/format_args-inl.hh>
+#endif
@@ -0,0 +1,376 @@
+/**
+ * @file format_engine.hh
+ * @brief std::format / {fmt} backed message formatting
+ *
+ * @details
+ * Alternative to the std::ostringstream based message builder, enabled with
+ * FAILSAFE_FORMAT_ENGINE:
+ * - FAILSAFE_FORMAT_ENGINE_STD: render through std::format (requires C++20 and
+ *   a standard library providing `<format>`)
+ * - FAILSAFE_FORMAT_ENGINE_FMT: render through the {fmt} library
+ *
+ * Built-in types (arithmetic, narrow and wide strings, pointers, system_clock
+ * time points, the hex/oct/bin/container/hexdump/case formatters and standard
+ * containers) are written straight into a reusable per-thread std::string.
+ * Everything else - optionals, variants, durations and user types with only
+ * an operator<< - goes through the regular append_to_stream() rules on a
+ * reused scratch stream, so the produced messages are byte-for-byte identical
+ * to the iostream engine.
+ *
+ * @note This header is included by string_utils.hh; do not include it directly.
+ */
+#pragma once
+
+#if FAILSAFE_FORMAT_ENGINE == FAILSAFE_FORMAT_ENGINE_STD
+    #if __has_include(<version>)
+        #include <version>
+    #endif
+    #if !defined(__cpp_lib_format)
+        #error "FAILSAFE_FORMAT_ENGINE_STD requires std::format (C++20 <format>)"
+    #endif
+    #include <format>
+#elif FAILSAFE_FORMAT_ENGINE == FAILSAFE_FORMAT_ENGINE_FMT
+    #if !__has_include(<fmt/format.h>)
+        #error "FAILSAFE_FORMAT_ENGINE_FMT requires the {fmt} library"
+    #endif
+    #include <fmt/format.h>
+#else
+    #error "Unknown FAILSAFE_FORMAT_ENGINE value"
+#endif
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace failsafe::detail {
+
+#if FAILSAFE_FORMAT_ENGINE == FAILSAFE_FORMAT_ENGINE_STD
+    namespace format_engine = ::std;
+#else
+    namespace format_engine = ::fmt;
+#endif
+
+    /**
+     * @internal
+     * @brief Per-thread buffers reused across messages
+     */
+    struct format_engine_buffers {
+        std::string message; ///< Output buffer for build_message()
+        std::ostringstream scratch; ///< Stream for operator<< fallbacks
+        bool message_busy = false; ///< Set while a message is being built
+        bool scratch_busy = false; ///< Set while the scratch stream is in use
+    };
+
+    /**
+     * @internal
+     * @brief Access the calling thread's buffers
+     */
+    inline format_engine_buffers& engine_buffers() {
+        thread_local format_engine_buffers buffers;
+        return buffers;
+    }
+
+    /**
+     * @internal
+     * @brief Borrow the per-thread message buffer
+     *
+     * A message built while another one is in progress on the same thread
+     * (e.g. from a user operator<<) gets a private buffer instead.
+     */
+    class message_buffer_lease {
+        public:
+            message_buffer_lease()
+                : buffers_(engine_buffers()),
+                  owner_(!buffers_.message_busy) {
+                if (owner_) {
+                    buffers_.message_busy = true;
+                    buffers_.message.clear();
+                }
+            }
+
+            ~message_buffer_lease() {
+                if (owner_) {
+                    buffers_.message_busy = false;
+                }
+            }
+
+            message_buffer_lease(const message_buffer_lease&) = delete;
+            message_buffer_lease& operator=(const message_buffer_lease&) = delete;
+
+            /** @brief The buffer to format into */
+            std::string& get() noexcept { return owner_ ? buffers_.message : local_; }
+
+        private:
+            format_engine_buffers& buffers_;
+            bool owner_;
+            std::string local_;
+    };
+
+    /**
+     * @internal
+     * @brief Render a value with append_to_stream() and copy the result
+     *
+     * Reuses the per-thread scratch stream, restoring the default stream
+     * state first so that flags leaked by a user operator<< do not carry over.
+     */
+    template<typename T>
+    void append_via_stream(std::string& out, const T& value) {
+        auto& buffers = engine_buffers();
+        if (buffers.scratch_busy) {
+            std::ostringstream local;
+            append_to_stream(local, value);
+            out += local.str();
+            return;
+        }
+
+        struct release {
+            bool& busy;
+            ~release() { busy = false; }
+        } guard{buffers.scratch_busy};
+        buffers.scratch_busy = true;
+
+        std::ostringstream& scratch = buffers.scratch;
+        scratch.str(std::string());
+        scratch.clear();
+        scratch.flags(std::ios_base::skipws | std::ios_base::dec);
+        scratch.precision(6);
+        scratch.width(0);
+        scratch.fill(' ');
+
+        append_to_stream(scratch, value);
+#if __cplusplus >= 202002L && defined(__cpp_lib_sstream_from_string_view)
+        out.append(scratch.view());
+#else
+        out += scratch.str();
+#endif
+    }
+
+    /**
+     * @internal
+     * @brief Characters printed as characters by operator<<
+     */
+    template<typename T>
+    inline constexpr bool is_narrow_char_v =
+        std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>;
+
+    /**
+     * @internal
+     * @brief Integers printed as numbers by operator<< (no bool, no character types)
+     */
+    template<typename T>
+    inline constexpr bool is_engine_integer_v =
+        std::is_integral_v<T> && !std::is_same_v<T, bool> && !is_narrow_char_v<T> &&
+        !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>
+#if defined(__cpp_char8_t)
+        && !std::is_same_v<T, char8_t>
+#endif
+        ;
+
+    /**
+     * @brief Append hexadecimal formatted value to a string buffer
+     */
+#if FAILSAFE_HAS_CONCEPTS
+    template<typename T>
+    void append_to_buffer(std::string& out, const hex_format<T>& fmt) {
+#else
+    template<typename T, typename Enable>
+    void append_to_buffer(std::string& out, const hex_format<T, Enable>& fmt) {
+#endif
+        render_hex(out, fmt);
+    }
+
+    /**
+     * @brief Append octal formatted value to a string buffer
+     */
+#if FAILSAFE_HAS_CONCEPTS
+    template<typename T>
+    void append_to_buffer(std::string& out, const oct_format<T>& fmt) {
+#else
+    template<typename T, typename Enable>
+    void append_to_buffer(std::string& out, const oct_format<T, Enable>& fmt) {
+#endif
+        std::uintmax_t value;
+        if constexpr (std::is_same_v<T, bool>) {
+            value = fmt.value ? 1U : 0U;
+        } else {
+            value = static_cast<std::make_unsigned_t<T>>(fmt.value);
+        }
+
+        // The '0' prefix counts towards the width, as with the stream engine
+        std::size_t width = fmt.width;
+        if (fmt.show_base && value != 0) {
+            sink_write(out, "0");
+            if (width > 0) {
+                --width;
+            }
+        }
+
+        auto it = std::back_inserter(out);
+        if (width > 0) {
+            format_engine::format_to(it, "{:0{}o}", value, width);
+        } else {
+            format_engine::format_to(it, "{:o}", value);
+        }
+    }
+
+    /**
+     * @brief Append binary formatted value to a string buffer
+     */
+#if FAILSAFE_HAS_CONCEPTS
+    template<typename T>
+    void append_to_buffer(std::string& out, const bin_format<T>& fmt) {
+#else
+    template<typename T, typename Enable>
+    void append_to_buffer(std::string& out, const bin_format<T, Enable>& fmt) {
+#endif
+        render_bin(out, fmt);
+    }
+
+    /**
+     * @brief Append container formatted value to a string buffer
+     */
+#if FAILSAFE_HAS_CONCEPTS
+    template<typename T>
+    void append_to_buffer(std::string& out, const container_format<T>& fmt) {
+#else
+    template<typename T, typename Enable>
+    void append_to_buffer(std::string& out, const container_format<T, Enable>& fmt) {
+#endif
+        render_container(out, fmt);
+    }
+
+    /**
+     * @brief Append hex dump to a string buffer
+     */
+    inline void append_to_buffer(std::string& out, const hexdump_format& fmt) {
+        render_hexdump(out, fmt);
+    }
+
+    /**
+     * @brief Append a wide string to a string buffer as UTF-8
+     */
+    inline void append_to_buffer(std::string& out, const std::wstring& value) {
+        sink_write_utf8(out, value.data(), value.size());
+    }
+
+    /**
+     * @brief Append a wide string view to a string buffer as UTF-8
+     */
+    inline void append_to_buffer(std::string& out, const std::wstring_view& value) {
+        sink_write_utf8(out, value.data(), value.size());
+    }
+
+    /**
+     * @brief Append a wide C string to a string buffer as UTF-8
+     */
+    inline void append_to_buffer(std::string& out, const wchar_t* value) {
+        if (value == nullptr) {
+            sink_write(out, "nullptr");
+        } else {
+            sink_write_utf8(out, value, std::char_traits<wchar_t>::length(value));
+        }
+    }
+
+    /**
+     * @brief Overload for non-const wchar_t*
+     */
+    inline void append_to_buffer(std::string& out, wchar_t* value) {
+        append_to_buffer(out, static_cast<const wchar_t*>(value));
+    }
+
+    /**
+     * @brief Append a system_clock time point to a string buffer as ISO 8601
+     */
+    inline void append_to_buffer(std::string& out, const std::chrono::system_clock::time_point& value) {
+        sink_write_timestamp(out, value);
+    }
+
+    /**
+     * @brief Generic append_to_buffer implementation
+     *
+     * Formats built-in types with the format engine and defers everything
+     * else to append_to_stream().
+     */
+    template<typename T>
+    void append_to_buffer(std::string& out, const T& value) {
+        using DecayT = std::decay_t<T>;
+
+        if constexpr (std::is_same_v<DecayT, bool>) {
+            sink_write(out, value ? "true" : "false");
+        } else if constexpr (is_narrow_char_v<DecayT>) {
+            out.push_back(static_cast<char>(value));
+        } else if constexpr (is_engine_integer_v<DecayT>) {
+            format_engine::format_to(std::back_inserter(out), "{}", value);
+        } else if constexpr (std::is_floating_point_v<DecayT>) {
+            // %g with precision 6, the default of std::ostream
+            format_engine::format_to(std::back_inserter(out), "{:g}", value);
+        } else if constexpr (std::is_same_v<DecayT, std::string> || std::is_same_v<DecayT, std::string_view>) {
+            sink_write(out, value);
+        } else if constexpr (std::is_array_v<T> && is_narrow_char_v<std::remove_cv_t<std::remove_extent_t<T>>>) {
+            // Character arrays print up to the terminator, like operator<<
+            out.append(reinterpret_cast<const char*>(value));
+        } else if constexpr (std::is_same_v<DecayT, const char*> || std::is_same_v<DecayT, char*>) {
+            if (value == nullptr) {
+                sink_write(out, "nullptr");
+            } else {
+                out.append(value);
+            }
+        } else if constexpr (std::is_pointer_v<DecayT> && !std::is_array_v<T> &&
+                             (std::is_void_v<std::remove_pointer_t<DecayT>> ||
+                              (std::is_object_v<std::remove_pointer_t<DecayT>> &&
+                               !is_narrow_char_v<std::remove_cv_t<std::remove_pointer_t<DecayT>>> &&
+                               !std::is_same_v<std::remove_cv_t<std::remove_pointer_t<DecayT>>, wchar_t>))) {
+            if (value == nullptr) {
+                sink_write(out, "nullptr");
+            } else {
+                format_engine::format_to(std::back_inserter(out), "{}", static_cast<const void*>(value));
+            }
+        } else if constexpr (std::is_same_v<DecayT, std::filesystem::path>) {
+            sink_write(out, value.string());
+        }
+#if FAILSAFE_HAS_CONCEPTS
+        else if constexpr (!std::is_same_v<DecayT, std::wstring> && !std::is_same_v<DecayT, std::wstring_view> &&
+                           !requires { value.has_value(); *value; } &&
+                           (container_like<DecayT> ||
+                            (has_begin_end<DecayT> && requires { typename DecayT::value_type; } &&
+                             !is_string_like<DecayT>))) {
+#else
+        else if constexpr (!std::is_same_v<DecayT, std::wstring> && !std::is_same_v<DecayT, std::wstring_view> &&
+                           !is_optional_v<DecayT> &&
+                           (container_like_v<DecayT> ||
+                            (has_begin_end_v<DecayT> && has_value_type<DecayT>::value &&
+                             !is_string_like_v<DecayT>))) {
+#endif
+            render_default_container(out, value);
+        } else {
+            append_via_stream(out, value);
+        }
+    }
+
+    /**
+     * @brief Append an uppercase formatted value, converted in place
+     */
+    template<typename T>
+    void append_to_buffer(std::string& out, const uppercase_format<T>& fmt) {
+        const std::size_t start = out.size();
+        append_to_buffer(out, fmt.value);
+        sink_transform_case<letter_case::upper>(out, start);
+    }
+
+    /**
+     * @brief Append a lowercase formatted value, converted in place
+     */
+    template<typename T>
+    void append_to_buffer(std::string& out, const lowercase_format<T>& fmt) {
+        const std::size_t start = out.size();
+        append_to_buffer(out, fmt.value);
+        sink_transform_case<letter_case::lower>(out, start);
+    }
+
+} // namespace failsafe::detail
@@ -0,0 +1,358 @@
+/**
+ * @file format_string.hh
+ * @brief Compile-time checked format strings for message building
+ *
+ * @details
+ * Provides an alternative to the space-joined build_message() API. The format
+ * string is parsed at compile time (consteval) into a precomputed layout of
+ * literal segments and placeholders, so that:
+ * - a mismatch between placeholders and arguments is a compile error
+ * - placeholder specs are checked against the argument types
+ * - literal text is emitted with precomputed lengths, no runtime parsing
+ *
+ * Supported syntax:
+ * - `{}`   - format the argument with the regular append_to_stream rules
+ * - `{:x}` - hexadecimal, `{:X}` uppercase hexadecimal (integral or pointer)
+ * - `{:o}` - octal (integral)
+ * - `{:b}` - binary (integral)
+ * - `#` before the type adds the base prefix, e.g. `{:#x}` -> "0xff"
+ * - `{{` and `}}` - literal braces
+ *
+ * Requires C++20 (consteval). FAILSAFE_HAS_FORMAT_STRING is defined to 1 when
+ * the facility is available.
+ *
+ * @example
+ * @code
+ * auto msg = format_message("took {} ms for {}", 42, "query");  // "took 42 ms for query"
+ * auto reg = format_message("reg={:#x} mask={:b}", 255, 5);      // "reg=0xff mask=101"
+ * // format_message("{} {}", 1);  // compile error: argument count mismatch
+ * @endcode
+ */
+#pragma once
+
+#include <failsafe/detail/features.hh>
+#include <failsafe/detail/string_utils.hh>
+
+#include <array>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if FAILSAFE_HAS_FORMAT_STRING
+
+namespace failsafe::detail {
+
+    /**
+     * @brief Rendering mode of a single placeholder
+     */
+    enum class placeholder_kind : unsigned char {
+        plain, ///< `{}`
+        hex, ///< `{:x}`
+        hex_upper, ///< `{:X}`
+        oct, ///< `{:o}`
+        bin ///< `{:b}`
+    };
+
+    /**
+     * @brief One element of a precomputed format layout
+     *
+     * Either a literal slice of the format string (offset/length) or a
+     * placeholder consuming the next argument.
+     */
+    struct format_segment {
+        std::size_t offset = 0; ///< Offset of literal text in the format string
+        std::size_t length = 0; ///< Length of literal text
+        bool placeholder = false; ///< True if this segment consumes an argument
+        placeholder_kind kind = placeholder_kind::plain; ///< Rendering mode for placeholders
+        bool show_base = false; ///< Whether `#` was given
+        bool escaped = false; ///< Literal text containing `{{`/`}}`, collapsed when written
+    };
+
+    /**
+     * @internal
+     * @brief Reached only during constant evaluation of an invalid format string
+     *
+     * Not constexpr on purpose: calling it from a consteval context turns the
+     * message into a compile error.
+     */
+    inline void format_string_error(const char* /*message*/) {}
+
+    /**
+     * @brief Format string parsed and validated at compile time
+     *
+     * Constructed implicitly from a string literal. The argument types are
+     * part of the type, so the placeholder count and the placeholder specs
+     * are checked against them during construction.
+     *
+     * @tparam Args Types of the arguments to be formatted
+     */
+    template<typename... Args>
+    class basic_format_string {
+        public:
+            /** @brief Maximum number of segments in the layout */
+            static constexpr std::size_t max_segments = 2 * sizeof...(Args) + 1;
+
+            /**
+             * @brief Parse and validate the format string
+             * @param str Format string (must be a constant expression)
+             */
+            template<typename S>
+                requires std::convertible_to<const S&, std::string_view>
+            consteval basic_format_string(const S& str)
+                : str_(str) {
+                parse();
+            }
+
+            /** @brief The original format string */
+            constexpr std::string_view get() const noexcept { return str_; }
+
+            /** @brief Number of segments in the precomputed layout */
+            constexpr std::size_t size() const noexcept { return count_; }
+
+            /** @brief Access a segment of the precomputed layout */
+            constexpr const format_segment& operator[](std::size_t i) const noexcept { return segments_[i]; }
+
+        private:
+            consteval void add_literal(std::size_t begin, std::size_t end, bool escaped) {
+                if (begin == end) {
+                    return;
+                }
+                segments_[count_++] = format_segment{begin, end - begin, false, placeholder_kind::plain, false, escaped};
+            }
+
+            consteval void parse() {
+                constexpr bool integral[] = {(std::is_integral_v<std::remove_cvref_t<Args>> &&
+                                              !std::is_same_v<std::remove_cvref_t<Args>, bool>)..., false};
+                constexpr bool pointer[] = {std::is_pointer_v<std::remove_cvref_t<Args>>..., false};
+
+                std::size_t literal_begin = 0;
+                std::size_t arg_index = 0;
+                // The current literal contains escapes; they stay in it and
+                // are collapsed when it is written
+                bool escaped = false;
+                std::size_t i = 0;
+
+                while (i < str_.size()) {
+                    char c = str_[i];
+                    if (c == '}') {
+                        if (i + 1 < str_.size() && str_[i + 1] == '}') {
+                            escaped = true;
+                            i += 2;
+                            continue;
+                        }
+                        format_string_error("unmatched '}' in format string");
+                    }
+                    if (c != '{') {
+                        ++i;
+                        continue;
+                    }
+                    if (i + 1 < str_.size() && str_[i + 1] == '{') {
+                        escaped = true;
+                        i += 2;
+                        continue;
+                    }
+
+                    add_literal(literal_begin, i, escaped);
+                    escaped = false;
+
+                    format_segment seg{};
+                    seg.placeholder = true;
+                    ++i;
+                    if (i < str_.size() && str_[i] == ':') {
+                        ++i;
+                        if (i < str_.size() && str_[i] == '#') {
+                            seg.show_base = true;
+                            ++i;
+                        }
+                        if (i >= str_.size()) {
+                            format_string_error("unterminated placeholder in format string");
+                        }
+                        switch (str_[i]) {
+                            case 'x': seg.kind = placeholder_kind::hex; break;
+                            case 'X': seg.kind = placeholder_kind::hex_upper; break;
+                            case 'o': seg.kind = placeholder_kind::oct; break;
+                            case 'b': seg.kind = placeholder_kind::bin; break;
+                            default: format_string_error("unsupported format spec, expected one of x, X, o, b");
+                        }
+                        ++i;
+                    }
+                    if (i >= str_.size() || str_[i] != '}') {
+                        format_string_error("expected '}' to close placeholder");
+                    }
+                    ++i;
+
+                    if (arg_index >= sizeof...(Args)) {
+                        format_string_error("more placeholders than arguments");
+                    }
+                    switch (seg.kind) {
+                        case placeholder_kind::hex:
+                        case placeholder_kind::hex_upper:
+                            if (!integral[arg_index] && !pointer[arg_index]) {
+                                format_string_error("{:x} requires an integral or pointer argument");
+                            }
+                            break;
+                        case placeholder_kind::oct:
+                        case placeholder_kind::bin:
+                            if (!integral[arg_index]) {
+                                format_string_error("{:o} and {:b} require an integral argument");
+                            }
+                            break;
+                        case placeholder_kind::plain:
+                            break;
+                    }
+                    ++arg_index;
+
+                    segments_[count_++] = seg;
+                    literal_begin = i;
+                }
+
+                add_literal(literal_begin, str_.size(), escaped);
+
+                if (arg_index != sizeof...(Args)) {
+                    format_string_error("fewer placeholders than arguments");
+                }
+            }
+
+            std::string_view str_;
+            std::array<format_segment, max_segments> segments_{};
+            std::size_t count_ = 0;
+    };
+
+    /**
+     * @brief Format string type checked against Args
+     *
+     * std::type_identity_t keeps the format string out of template argument
+     * deduction, so Args are deduced from the actual arguments only.
+     */
+    template<typename... Args>
+    using format_string = basic_format_string<std::type_identity_t<Args>...>;
+
+    /**
+     * @internal
+     * @brief Write literal text, collapsing each `{{` and `}}` to one brace
+     *
+     * The text comes from a validated format string, so every brace in it
+     * is doubled.
+     */
+    template<typename Sink>
+    void write_escaped_literal(Sink& out, std::string_view text) {
+        std::size_t begin = 0;
+        for (std::size_t i = 0; i < text.size(); ++i) {
+            if (text[i] == '{' || text[i] == '}') {
+                // Keep the first brace, skip its double
+                sink_write(out, text.substr(begin, i + 1 - begin));
+                begin = ++i + 1;
+            }
+        }
+        sink_write(out, text.substr(begin));
+    }
+
+    /**
+     * @internal
+     * @brief Render one argument according to its placeholder spec
+     */
+    template<typename Sink, typename T>
+    void append_placeholder(Sink& out, const format_segment& seg, T&& value) {
+        using U = std::remove_cvref_t<T>;
+        if constexpr ((std::is_integral_v<U> && !std::is_same_v<U, bool>) || std::is_pointer_v<U>) {
+            switch (seg.kind) {
+                case placeholder_kind::hex:
+                case placeholder_kind::hex_upper:
+                    sink_append(out, hex_format<U>{value, 0, seg.show_base,
+                                                   seg.kind == placeholder_kind::hex_upper});
+                    return;
+                case placeholder_kind::oct:
+                    if constexpr (std::is_integral_v<U>) {
+                        sink_append(out, oct_format<U>{value, 0, seg.show_base});
+                        return;
+                    }
+                    break;
+                case placeholder_kind::bin:
+                    if constexpr (std::is_integral_v<U>) {
+                        sink_append(out, bin_format<U>{value, 0, seg.show_base, 0});
+                        return;
+                    }
+                    break;
+                case placeholder_kind::plain:
+                    break;
+            }
+        }
+        sink_append(out, std::forward<T>(value));
+    }
+
+    /**
+     * @brief Append a formatted message to a sink
+     *
+     * Literal segments are written with their precomputed lengths; each
+     * placeholder consumes the next argument in order.
+     *
+     * @param out Destination stream or string buffer
+     * @param fmt Compile-time checked format string
+     * @param args Arguments, one per placeholder
+     */
+    template<typename Sink, typename... Args>
+    void format_to_sink(Sink& out, format_string<Args...> fmt, Args&&... args) {
+        const std::string_view text = fmt.get();
+        std::size_t seg = 0;
+
+        auto emit_literals = [&]() {
+            while (seg < fmt.size() && !fmt[seg].placeholder) {
+                const std::string_view literal = text.substr(fmt[seg].offset, fmt[seg].length);
+                if (fmt[seg].escaped) {
+                    write_escaped_literal(out, literal);
+                } else {
+                    sink_write(out, literal);
+                }
+                ++seg;
+            }
+        };
+
+        ((emit_literals(), append_placeholder(out, fmt[seg++], std::forward<Args>(args))), ...);
+        emit_literals();
+    }
+
+    /**
+     * @brief Append a formatted message to a stream
+     *
+     * @param oss Destination stream
+     * @param fmt Compile-time checked format string
+     * @param args Arguments, one per placeholder
+     */
+    template<typename... Args>
+    void format_to_stream(std::ostringstream& oss, format_string<Args...> fmt, Args&&... args) {
+        format_to_sink<std::ostringstream, Args...>(oss, fmt, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Build a message string from a compile-time checked format string
+     *
+     * Unlike build_message(), arguments are not joined with spaces: the
+     * format string fully controls the layout.
+     *
+     * @param fmt Compile-time checked format string
+     * @param args Arguments, one per placeholder
+     * @return The formatted message
+     *
+     * @code
+     * format_message("took {} ms for {}", 42, "query");  // "took 42 ms for query"
+     * @endcode
+     */
+    template<typename... Args>
+    std::string format_message(format_string<Args...> fmt, Args&&... args) {
+#if FAILSAFE_FORMAT_ENGINE != FAILSAFE_FORMAT_ENGINE_IOSTREAM
+        message_buffer_lease lease;
+        format_to_sink<std::string, Args...>(lease.get(), fmt, std::forward<Args>(args)...);
+        return std::string(lease.get());
+#else
+        std::ostringstream oss;
+        format_to_stream<Args...>(oss, fmt, std::forward<Args>(args)...);
+        return oss.str();
+#endif
+    }
+
+} // namespace failsafe::detail
+
+#endif // FAILSAFE_HAS_FORMAT_STRING
@@ -0,0 +1,95 @@
+/**
+ * @file location_format-inl.hh
+ * @brief Definitions of the location_format.hh functions
+ *
+ * @note Included by location_format.hh in header-only mode and compiled into
+ *       failsafe_impl otherwise, see export.hh.
+ */
+#pragma once
+
+#include <failsafe/detail/location_format.hh>
+
+namespace failsafe::detail {
+
+    FAILSAFE_INLINE const char* extract_filename(const char* path) {
+        if (!path) return "<unknown>";
+        
+        const char* last_slash = nullptr;
+        const char* p = path;
+        
+        while (*p) {
+            if (*p == '/' || *p == '\\') {
+                last_slash = p;
+            }
+            ++p;
+        }
+        
+        return last_slash ? last_slash + 1 : path;
+    }
+
+    FAILSAFE_INLINE std::string format_file_path(const char* file) {
+        if (!file) return "<unknown>";
+        
+        #if FAILSAFE_LOCATION_PATH_STYLE == 0
+            // Full path
+            return file;
+        #elif FAILSAFE_LOCATION_PATH_STYLE == 1
+            // Filename only
+            return extract_filename(file);
+        #elif FAILSAFE_LOCATION_PATH_STYLE == 2
+            // Relative to project root
+            #ifdef FAILSAFE_PROJECT_ROOT
+                const char* root = FAILSAFE_PROJECT_ROOT;
+                const char* relative = std::strstr(file, root);
+                if (relative && relative == file) {
+                    // Skip the root path and any following slash
+                    file += std::strlen(root);
+                    while (*file == '/' || *file == '\\') ++file;
+                }
+            #endif
+            return file;
+        #else
+            return file;
+        #endif
+    }
+
+    FAILSAFE_INLINE std::string format_location(const char* file, int line) {
+        std::ostringstream oss;
+        std::string formatted_file = format_file_path(file);
+        
+        #if FAILSAFE_LOCATION_FORMAT_STYLE == 0
+            // [file:line]
+            oss << "[" << formatted_file << ":" << line << "]";
+        #elif FAILSAFE_LOCATION_FORMAT_STYLE == 1
+            // file:line:
+            oss << formatted_file << ":" << line << ":";
+        #elif FAILSAFE_LOCATION_FORMAT_STYLE == 2
+            // (file:line)
+            oss << "(" << formatted_file << ":" << line << ")";
+        #elif FAILSAFE_LOCATION_FORMAT_STYLE == 3
+            // file(line):
+            oss << formatted_file << "(" << line << "):";
+        #elif FAILSAFE_LOCATION_FORMAT_STYLE == 4
+            // @file:line
+            oss << "@" << formatted_file << ":" << line;
+        #elif FAILSAFE_LOCATION_FORMAT_STYLE == 5
+            // file:line -
+            oss << formatted_file << ":" << line << " -";
+        #else
+            // Default to style 0
+            oss << "[" << formatted_file << ":" << line << "]";
+        #endif
+        
+        return oss.str();
+    }
+
+    FAILSAFE_INLINE void append_location(std::ostream& os, const char* file, int line) {
+        os << format_location(file, line);
+    }
+
+    FAILSAFE_INLINE std::string format_location_with_separator(const char* file, int line, 
+                                                               const char* separator) {
+        return format_location(file, line) + separator;
+    }
+
+} // namespace failsafe::detail
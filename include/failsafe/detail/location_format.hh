@@ -22,6 +22,8 @@
 #include <sstream>
 #include <cstring>
 
+#include <failsafe/detail/export.hh>
+
 // Check for C++20 source_location support
 #if __has_include(<source_location>) && __cplusplus >= 202002L
     #include <source_location>
@@ -89,21 +91,7 @@ namespace failsafe::detail {
      * @param path Full file path
      * @return Pointer to filename portion or "<unknown>" if null
      */
-    inline const char* extract_filename(const char* path) {
-        if (!path) return "<unknown>";
-        
-        const char* last_slash = nullptr;
-        const char* p = path;
-        
-        while (*p) {
-            if (*p == '/' || *p == '\\') {
-                last_slash = p;
-            }
-            ++p;
-        }
-        
-        return last_slash ? last_slash + 1 : path;
-    }
+    FAILSAFE_API const char* extract_filename(const char* path);
     
     /**
      * @brief Format file path based on configuration
@@ -113,31 +101,7 @@ namespace failsafe::detail {
      * @param file Raw file path
      * @return Formatted file path string
      */
-    inline std::string format_file_path(const char* file) {
-        if (!file) return "<unknown>";
-        
-        #if FAILSAFE_LOCATION_PATH_STYLE == 0
-            // Full path
-            return file;
-        #elif FAILSAFE_LOCATION_PATH_STYLE == 1
-            // Filename only
-            return extract_filename(file);
-        #elif FAILSAFE_LOCATION_PATH_STYLE == 2
-            // Relative to project root
-            #ifdef FAILSAFE_PROJECT_ROOT
-                const char* root = FAILSAFE_PROJECT_ROOT;
-                const char* relative = std::strstr(file, root);
-                if (relative && relative == file) {
-                    // Skip the root path and any following slash
-                    file += std::strlen(root);
-                    while (*file == '/' || *file == '\\') ++file;
-                }
-            #endif
-            return file;
-        #else
-            return file;
-        #endif
-    }
+    FAILSAFE_API std::string format_file_path(const char* file);
     
     /**
      * @brief Format complete source location
@@ -148,35 +112,7 @@ namespace failsafe::detail {
      * @param line Source line number
      * @return Formatted location string
      */
-    inline std::string format_location(const char* file, int line) {
-        std::ostringstream oss;
-        std::string formatted_file = format_file_path(file);
-        
-        #if FAILSAFE_LOCATION_FORMAT_STYLE == 0
-            // [file:line]
-            oss << "[" << formatted_file << ":" << line << "]";
-        #elif FAILSAFE_LOCATION_FORMAT_STYLE == 1
-            // file:line:
-            oss << formatted_file << ":" << line << ":";
-        #elif FAILSAFE_LOCATION_FORMAT_STYLE == 2
-            // (file:line)
-            oss << "(" << formatted_file << ":" << line << ")";
-        #elif FAILSAFE_LOCATION_FORMAT_STYLE == 3
-            // file(line):
-            oss << formatted_file << "(" << line << "):";
-        #elif FAILSAFE_LOCATION_FORMAT_STYLE == 4
-            // @file:line
-            oss << "@" << formatted_file << ":" << line;
-        #elif FAILSAFE_LOCATION_FORMAT_STYLE == 5
-            // file:line -
-            oss << formatted_file << ":" << line << " -";
-        #else
-            // Default to style 0
-            oss << "[" << formatted_file << ":" << line << "]";
-        #endif
-        
-        return oss.str();
-    }
+    FAILSAFE_API std::string format_location(const char* file, int line);
     
     /**
      * @brief Append formatted location to output stream
@@ -185,9 +121,7 @@ namespace failsafe::detail {
      * @param file Source file path
      * @param line Source line number
      */
-    inline void append_location(std::ostream& os, const char* file, int line) {
-        os << format_location(file, line);
-    }
+    FAILSAFE_API void append_location(std::ostream& os, const char* file, int line);
     
     /**
      * @brief Format location with custom separator
@@ -197,10 +131,8 @@ namespace failsafe::detail {
      * @param separator String to append after location
      * @return Formatted location with separator
      */
-    inline std::string format_location_with_separator(const char* file, int line, 
-                                                      const char* separator = " ") {
-        return format_location(file, line) + separator;
-    }
+    FAILSAFE_API std::string format_location_with_separator(const char* file, int line, 
+                                                            const char* separator = " ");
     
     /**
      * @brief Portable source location structure
@@ -286,3 +218,7 @@ namespace failsafe::detail {
     #endif
 
 } // namespace failsafe::detail
+
+#ifdef FAILSAFE_HEADER_ONLY
+#include <failsafe/detail/location_format-inl.hh>
+#endif
@@ -0,0 +1,564 @@
+/**
+ * @file logger_macros.hh
+ * @brief Log levels, compile-time logger configuration and LOG_* macros
+ *
+ * @details
+ * Preprocessor definitions only. Included by logger.hh, and by macros.hh
+ * for translation units that use `import failsafe;`.
+ */
+#pragma once
+
+#include <failsafe/detail/attributes.hh>
+#include <failsafe/detail/features.hh>
+
+/**
+ * @defgroup LogLevels Logging Levels
+ * @{
+ */
+
+/** @brief Most detailed logging level for tracing execution flow */
+#define LOGGER_LEVEL_TRACE 0
+
+/** @brief Debug messages for development and troubleshooting */
+#define LOGGER_LEVEL_DEBUG 1
+
+/** @brief Informational messages about normal operation */
+#define LOGGER_LEVEL_INFO  2
+
+/** @brief Warning messages for potentially problematic situations */
+#define LOGGER_LEVEL_WARN  3
+
+/** @brief Error messages for recoverable errors */
+#define LOGGER_LEVEL_ERROR 4
+
+/** @brief Fatal error messages for unrecoverable errors */
+#define LOGGER_LEVEL_FATAL 5
+
+/** @} */ // end of LogLevels group
+
+/**
+ * @brief Minimum compile-time log level
+ * 
+ * Messages below this level are completely removed at compile time.
+ * Default is TRACE level (all levels enabled). Can be overridden by defining before including this header.
+ * For production builds, consider setting this to LOGGER_LEVEL_INFO or higher to remove debug/trace logs.
+ */
+#ifndef LOGGER_MIN_LEVEL
+#define LOGGER_MIN_LEVEL LOGGER_LEVEL_TRACE
+#endif
+
+/**
+ * @brief Compile-time minimum log levels of individual categories
+ *
+ * Not defined by default. When defined, it is a comma separated list of
+ * `{"Category", LOGGER_LEVEL_*}` pairs; LOG_CAT_* calls for a listed category
+ * are removed at compile time below that category's level, all other LOG_CAT_*
+ * calls below LOGGER_MIN_LEVEL. A listed level may be lower than
+ * LOGGER_MIN_LEVEL, to keep debug output of selected categories in release builds:
+ *
+ * @code
+ * #define LOGGER_MIN_LEVEL LOGGER_LEVEL_INFO
+ * #define LOGGER_CATEGORY_MIN_LEVELS {"Network", LOGGER_LEVEL_DEBUG}, {"Storage", LOGGER_LEVEL_DEBUG}
+ * #include <failsafe/logger.hh>
+ * @endcode
+ *
+ * With the table defined, the LOG_CAT_* macros become statements (like
+ * LOG_IF) and their category must be a constant expression, e.g. a string
+ * literal; use LOG_CAT_RUNTIME for categories only known at run time. The
+ * LOG_* macros without category are always governed by LOGGER_MIN_LEVEL.
+ */
+#ifdef LOGGER_CATEGORY_MIN_LEVELS
+    #define LOGGER_HAS_CATEGORY_MIN_LEVELS 1
+#else
+    #define LOGGER_HAS_CATEGORY_MIN_LEVELS 0
+#endif
+
+/** @internal Stringification helper macro */
+#define LOGGER_STRINGIFY(x) #x
+
+/** @internal Stringification helper macro */
+#define LOGGER_TOSTRING(x) LOGGER_STRINGIFY(x)
+
+/**
+ * @brief Default logging category
+ * 
+ * Used when no category is specified. Default is "Application".
+ * Can be overridden by defining before including this header.
+ */
+#ifndef LOGGER_DEFAULT_CATEGORY
+    #define LOGGER_DEFAULT_CATEGORY Application
+#endif
+
+/** @internal Create string from category macro */
+#define LOGGER_DEFAULT_CATEGORY_STR LOGGER_TOSTRING(LOGGER_DEFAULT_CATEGORY)
+
+/**
+ * @defgroup LogMacros Logging Macros
+ * @{
+ */
+
+/**
+ * @brief Log a trace message with lazy evaluation
+ * @param ... Variable arguments for message formatting
+ * @note Arguments are only evaluated if TRACE level is enabled
+ * @note Removed at compile time if LOGGER_MIN_LEVEL > TRACE
+ */
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_TRACE
+#define LOG_TRACE(...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_TRACE) ? void() : \
+    (::failsafe::logger::log_with_level<LOGGER_LEVEL_TRACE>(LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_TRACE(...) ((void)0)
+#endif
+
+/**
+ * @brief Log a debug message with lazy evaluation
+ * @param ... Variable arguments for message formatting
+ * @note Arguments are only evaluated if DEBUG level is enabled
+ * @note Removed at compile time if LOGGER_MIN_LEVEL > DEBUG
+ */
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_DEBUG
+#define LOG_DEBUG(...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_DEBUG) ? void() : \
+    (::failsafe::logger::log_with_level<LOGGER_LEVEL_DEBUG>(LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_DEBUG(...) ((void)0)
+#endif
+
+/**
+ * @brief Log an informational message with lazy evaluation
+ * @param ... Variable arguments for message formatting
+ * @note Arguments are only evaluated if INFO level is enabled
+ * @note Removed at compile time if LOGGER_MIN_LEVEL > INFO
+ */
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_INFO
+#define LOG_INFO(...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_INFO) ? void() : \
+    (::failsafe::logger::log_with_level<LOGGER_LEVEL_INFO>(LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_INFO(...) ((void)0)
+#endif
+
+/**
+ * @brief Log a warning message with lazy evaluation
+ * @param ... Variable arguments for message formatting
+ * @note Arguments are only evaluated if WARN level is enabled
+ * @note Removed at compile time if LOGGER_MIN_LEVEL > WARN
+ */
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_WARN
+#define LOG_WARN(...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_WARN) ? void() : \
+    (::failsafe::logger::log_with_level<LOGGER_LEVEL_WARN>(LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_WARN(...) ((void)0)
+#endif
+
+/**
+ * @brief Log an error message with lazy evaluation
+ * @param ... Variable arguments for message formatting
+ * @note Arguments are only evaluated if ERROR level is enabled
+ * @note Removed at compile time if LOGGER_MIN_LEVEL > ERROR
+ */
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_ERROR
+#define LOG_ERROR(...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_ERROR) ? void() : \
+    (::failsafe::logger::log_with_level<LOGGER_LEVEL_ERROR>(LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_ERROR(...) ((void)0)
+#endif
+
+/**
+ * @brief Log a fatal error message with lazy evaluation
+ * @param ... Variable arguments for message formatting
+ * @note Arguments are only evaluated if FATAL level is enabled
+ * @note Removed at compile time if LOGGER_MIN_LEVEL > FATAL
+ */
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_FATAL
+#define LOG_FATAL(...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_FATAL) ? void() : \
+    (::failsafe::logger::log_with_level<LOGGER_LEVEL_FATAL>(LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_FATAL(...) ((void)0)
+#endif
+
+/** @} */ // end of LogMacros group
+
+#if LOGGER_HAS_CATEGORY_MIN_LEVELS
+/**
+ * @internal
+ * @brief Category call site filtered with LOGGER_CATEGORY_MIN_LEVELS
+ *
+ * Calls below the category's compile-time minimum level are discarded by
+ * `if constexpr`, so neither their arguments nor the message building code
+ * are compiled.
+ */
+#define LOGGER_CAT_STATIC_LOG(level, function, category, ...) \
+    do { \
+        if constexpr (::failsafe::logger::is_category_level_compiled_in(level, category)) { \
+            if (FAILSAFE_UNLIKELY(::failsafe::logger::internal::runtime_min_level.load() <= (level))) { \
+                ::failsafe::logger::function<level>(category, __FILE__, __LINE__, __VA_ARGS__); \
+            } \
+        } \
+    } while (0)
+#endif
+
+/**
+ * @defgroup CategoryLogMacros Category-based Logging Macros
+ *
+ * Filtered at compile time by LOGGER_MIN_LEVEL, or per category by
+ * LOGGER_CATEGORY_MIN_LEVELS when that is defined.
+ * @{
+ */
+
+/**
+ * @brief Log a trace message with custom category (lazy evaluation)
+ * @param category The log category string
+ * @param ... Variable arguments for message formatting
+ */
+#if LOGGER_HAS_CATEGORY_MIN_LEVELS
+#define LOG_CAT_TRACE(category, ...) \
+    LOGGER_CAT_STATIC_LOG(LOGGER_LEVEL_TRACE, log_with_level, category, __VA_ARGS__)
+#elif LOGGER_MIN_LEVEL <= LOGGER_LEVEL_TRACE
+#define LOG_CAT_TRACE(category, ...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_TRACE) ? void() : \
+    (::failsafe::logger::log_with_level<LOGGER_LEVEL_TRACE>(category, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_CAT_TRACE(category, ...) ((void)0)
+#endif
+
+/**
+ * @brief Log a debug message with custom category (lazy evaluation)
+ * @param category The log category string
+ * @param ... Variable arguments for message formatting
+ */
+#if LOGGER_HAS_CATEGORY_MIN_LEVELS
+#define LOG_CAT_DEBUG(category, ...) \
+    LOGGER_CAT_STATIC_LOG(LOGGER_LEVEL_DEBUG, log_with_level, category, __VA_ARGS__)
+#elif LOGGER_MIN_LEVEL <= LOGGER_LEVEL_DEBUG
+#define LOG_CAT_DEBUG(category, ...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_DEBUG) ? void() : \
+    (::failsafe::logger::log_with_level<LOGGER_LEVEL_DEBUG>(category, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_CAT_DEBUG(category, ...) ((void)0)
+#endif
+
+/**
+ * @brief Log an info message with custom category (lazy evaluation)
+ * @param category The log category string
+ * @param ... Variable arguments for message formatting
+ */
+#if LOGGER_HAS_CATEGORY_MIN_LEVELS
+#define LOG_CAT_INFO(category, ...) \
+    LOGGER_CAT_STATIC_LOG(LOGGER_LEVEL_INFO, log_with_level, category, __VA_ARGS__)
+#elif LOGGER_MIN_LEVEL <= LOGGER_LEVEL_INFO
+#define LOG_CAT_INFO(category, ...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_INFO) ? void() : \
+    (::failsafe::logger::log_with_level<LOGGER_LEVEL_INFO>(category, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_CAT_INFO(category, ...) ((void)0)
+#endif
+
+/**
+ * @brief Log a warning message with custom category (lazy evaluation)
+ * @param category The log category string
+ * @param ... Variable arguments for message formatting
+ */
+#if LOGGER_HAS_CATEGORY_MIN_LEVELS
+#define LOG_CAT_WARN(category, ...) \
+    LOGGER_CAT_STATIC_LOG(LOGGER_LEVEL_WARN, log_with_level, category, __VA_ARGS__)
+#elif LOGGER_MIN_LEVEL <= LOGGER_LEVEL_WARN
+#define LOG_CAT_WARN(category, ...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_WARN) ? void() : \
+    (::failsafe::logger::log_with_level<LOGGER_LEVEL_WARN>(category, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_CAT_WARN(category, ...) ((void)0)
+#endif
+
+/**
+ * @brief Log an error message with custom category (lazy evaluation)
+ * @param category The log category string
+ * @param ... Variable arguments for message formatting
+ */
+#if LOGGER_HAS_CATEGORY_MIN_LEVELS
+#define LOG_CAT_ERROR(category, ...) \
+    LOGGER_CAT_STATIC_LOG(LOGGER_LEVEL_ERROR, log_with_level, category, __VA_ARGS__)
+#elif LOGGER_MIN_LEVEL <= LOGGER_LEVEL_ERROR
+#define LOG_CAT_ERROR(category, ...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_ERROR) ? void() : \
+    (::failsafe::logger::log_with_level<LOGGER_LEVEL_ERROR>(category, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_CAT_ERROR(category, ...) ((void)0)
+#endif
+
+/**
+ * @brief Log a fatal error message with custom category (lazy evaluation)
+ * @param category The log category string
+ * @param ... Variable arguments for message formatting
+ */
+#if LOGGER_HAS_CATEGORY_MIN_LEVELS
+#define LOG_CAT_FATAL(category, ...) \
+    LOGGER_CAT_STATIC_LOG(LOGGER_LEVEL_FATAL, log_with_level, category, __VA_ARGS__)
+#elif LOGGER_MIN_LEVEL <= LOGGER_LEVEL_FATAL
+#define LOG_CAT_FATAL(category, ...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_FATAL) ? void() : \
+    (::failsafe::logger::log_with_level<LOGGER_LEVEL_FATAL>(category, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_CAT_FATAL(category, ...) ((void)0)
+#endif
+
+/** @} */ // end of CategoryLogMacros group
+
+#if FAILSAFE_HAS_FORMAT_STRING
+/**
+ * @defgroup FormatLogMacros Format-string Logging Macros
+ * @brief Logging with compile-time checked format strings (C++20)
+ *
+ * The first argument is a format string with `{}` placeholders, parsed and
+ * validated at compile time. A placeholder/argument count mismatch or an
+ * unsupported spec is a compile error. Evaluation is lazy, as with LOG_*.
+ *
+ * @code
+ * LOG_INFO_F("took {} ms for {}", ms, name);
+ * LOG_CAT_DEBUG_F("network", "packet {} flags={:#b}", id, flags);
+ * @endcode
+ * @{
+ */
+
+/**
+ * @brief Log a trace message with a compile-time checked format string
+ * @param ... Format string followed by its arguments
+ * @note Removed at compile time if LOGGER_MIN_LEVEL > TRACE
+ */
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_TRACE
+#define LOG_TRACE_F(...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_TRACE) ? void() : \
+    (::failsafe::logger::log_format_with_level<LOGGER_LEVEL_TRACE>(LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_TRACE_F(...) ((void)0)
+#endif
+
+/**
+ * @brief Log a debug message with a compile-time checked format string
+ * @param ... Format string followed by its arguments
+ * @note Removed at compile time if LOGGER_MIN_LEVEL > DEBUG
+ */
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_DEBUG
+#define LOG_DEBUG_F(...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_DEBUG) ? void() : \
+    (::failsafe::logger::log_format_with_level<LOGGER_LEVEL_DEBUG>(LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_DEBUG_F(...) ((void)0)
+#endif
+
+/**
+ * @brief Log an informational message with a compile-time checked format string
+ * @param ... Format string followed by its arguments
+ * @note Removed at compile time if LOGGER_MIN_LEVEL > INFO
+ */
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_INFO
+#define LOG_INFO_F(...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_INFO) ? void() : \
+    (::failsafe::logger::log_format_with_level<LOGGER_LEVEL_INFO>(LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_INFO_F(...) ((void)0)
+#endif
+
+/**
+ * @brief Log a warning message with a compile-time checked format string
+ * @param ... Format string followed by its arguments
+ * @note Removed at compile time if LOGGER_MIN_LEVEL > WARN
+ */
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_WARN
+#define LOG_WARN_F(...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_WARN) ? void() : \
+    (::failsafe::logger::log_format_with_level<LOGGER_LEVEL_WARN>(LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_WARN_F(...) ((void)0)
+#endif
+
+/**
+ * @brief Log an error message with a compile-time checked format string
+ * @param ... Format string followed by its arguments
+ * @note Removed at compile time if LOGGER_MIN_LEVEL > ERROR
+ */
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_ERROR
+#define LOG_ERROR_F(...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_ERROR) ? void() : \
+    (::failsafe::logger::log_format_with_level<LOGGER_LEVEL_ERROR>(LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_ERROR_F(...) ((void)0)
+#endif
+
+/**
+ * @brief Log a fatal error message with a compile-time checked format string
+ * @param ... Format string followed by its arguments
+ * @note Removed at compile time if LOGGER_MIN_LEVEL > FATAL
+ */
+#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_FATAL
+#define LOG_FATAL_F(...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_FATAL) ? void() : \
+    (::failsafe::logger::log_format_with_level<LOGGER_LEVEL_FATAL>(LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_FATAL_F(...) ((void)0)
+#endif
+
+/**
+ * @brief Log a trace message with custom category and a compile-time checked format string
+ * @param category The log category string
+ * @param ... Format string followed by its arguments
+ */
+#if LOGGER_HAS_CATEGORY_MIN_LEVELS
+#define LOG_CAT_TRACE_F(category, ...) \
+    LOGGER_CAT_STATIC_LOG(LOGGER_LEVEL_TRACE, log_format_with_level, category, __VA_ARGS__)
+#elif LOGGER_MIN_LEVEL <= LOGGER_LEVEL_TRACE
+#define LOG_CAT_TRACE_F(category, ...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_TRACE) ? void() : \
+    (::failsafe::logger::log_format_with_level<LOGGER_LEVEL_TRACE>(category, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_CAT_TRACE_F(category, ...) ((void)0)
+#endif
+
+/**
+ * @brief Log a debug message with custom category and a compile-time checked format string
+ * @param category The log category string
+ * @param ... Format string followed by its arguments
+ */
+#if LOGGER_HAS_CATEGORY_MIN_LEVELS
+#define LOG_CAT_DEBUG_F(category, ...) \
+    LOGGER_CAT_STATIC_LOG(LOGGER_LEVEL_DEBUG, log_format_with_level, category, __VA_ARGS__)
+#elif LOGGER_MIN_LEVEL <= LOGGER_LEVEL_DEBUG
+#define LOG_CAT_DEBUG_F(category, ...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_DEBUG) ? void() : \
+    (::failsafe::logger::log_format_with_level<LOGGER_LEVEL_DEBUG>(category, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_CAT_DEBUG_F(category, ...) ((void)0)
+#endif
+
+/**
+ * @brief Log an info message with custom category and a compile-time checked format string
+ * @param category The log category string
+ * @param ... Format string followed by its arguments
+ */
+#if LOGGER_HAS_CATEGORY_MIN_LEVELS
+#define LOG_CAT_INFO_F(category, ...) \
+    LOGGER_CAT_STATIC_LOG(LOGGER_LEVEL_INFO, log_format_with_level, category, __VA_ARGS__)
+#elif LOGGER_MIN_LEVEL <= LOGGER_LEVEL_INFO
+#define LOG_CAT_INFO_F(category, ...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_INFO) ? void() : \
+    (::failsafe::logger::log_format_with_level<LOGGER_LEVEL_INFO>(category, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_CAT_INFO_F(category, ...) ((void)0)
+#endif
+
+/**
+ * @brief Log a warning message with custom category and a compile-time checked format string
+ * @param category The log category string
+ * @param ... Format string followed by its arguments
+ */
+#if LOGGER_HAS_CATEGORY_MIN_LEVELS
+#define LOG_CAT_WARN_F(category, ...) \
+    LOGGER_CAT_STATIC_LOG(LOGGER_LEVEL_WARN, log_format_with_level, category, __VA_ARGS__)
+#elif LOGGER_MIN_LEVEL <= LOGGER_LEVEL_WARN
+#define LOG_CAT_WARN_F(category, ...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_WARN) ? void() : \
+    (::failsafe::logger::log_format_with_level<LOGGER_LEVEL_WARN>(category, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_CAT_WARN_F(category, ...) ((void)0)
+#endif
+
+/**
+ * @brief Log an error message with custom category and a compile-time checked format string
+ * @param category The log category string
+ * @param ... Format string followed by its arguments
+ */
+#if LOGGER_HAS_CATEGORY_MIN_LEVELS
+#define LOG_CAT_ERROR_F(category, ...) \
+    LOGGER_CAT_STATIC_LOG(LOGGER_LEVEL_ERROR, log_format_with_level, category, __VA_ARGS__)
+#elif LOGGER_MIN_LEVEL <= LOGGER_LEVEL_ERROR
+#define LOG_CAT_ERROR_F(category, ...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_ERROR) ? void() : \
+    (::failsafe::logger::log_format_with_level<LOGGER_LEVEL_ERROR>(category, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_CAT_ERROR_F(category, ...) ((void)0)
+#endif
+
+/**
+ * @brief Log a fatal error message with custom category and a compile-time checked format string
+ * @param category The log category string
+ * @param ... Format string followed by its arguments
+ */
+#if LOGGER_HAS_CATEGORY_MIN_LEVELS
+#define LOG_CAT_FATAL_F(category, ...) \
+    LOGGER_CAT_STATIC_LOG(LOGGER_LEVEL_FATAL, log_format_with_level, category, __VA_ARGS__)
+#elif LOGGER_MIN_LEVEL <= LOGGER_LEVEL_FATAL
+#define LOG_CAT_FATAL_F(category, ...) \
+    FAILSAFE_LIKELY(::failsafe::logger::internal::runtime_min_level.load() > LOGGER_LEVEL_FATAL) ? void() : \
+    (::failsafe::logger::log_format_with_level<LOGGER_LEVEL_FATAL>(category, __FILE__, __LINE__, __VA_ARGS__), void())
+#else
+#define LOG_CAT_FATAL_F(category, ...) ((void)0)
+#endif
+
+/** @} */ // end of FormatLogMacros group
+#endif // FAILSAFE_HAS_FORMAT_STRING
+
+/**
+ * @defgroup ConditionalLogMacros Conditional Logging Macros
+ * @{
+ */
+
+/**
+ * @brief Log a message only if condition is true
+ * 
+ * @param condition Boolean condition to check
+ * @param level Log level (runtime value)
+ * @param ... Message arguments
+ * 
+ * @example
+ * @code
+ * LOG_IF(verbose_mode, LOGGER_LEVEL_DEBUG, "Detailed info:", data);
+ * @endcode
+ */
+#define LOG_IF(condition, level, ...) \
+    do { \
+        if (condition) { \
+            ::failsafe::logger::log(level, LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__); \
+        } \
+    } while(0)
+
+/**
+ * @brief Log a message with category only if condition is true
+ * 
+ * @param condition Boolean condition to check
+ * @param level Log level (runtime value)
+ * @param category Log category string
+ * @param ... Message arguments
+ */
+#define LOG_CAT_IF(condition, level, category, ...) \
+    do { \
+        if (condition) { \
+            ::failsafe::logger::log(level, category, __FILE__, __LINE__, __VA_ARGS__); \
+        } \
+    } while(0)
+
+/**
+ * @brief Log with runtime-determined level
+ * 
+ * Use when log level is not a compile-time constant.
+ * 
+ * @param level Log level (runtime value)
+ * @param ... Message arguments
+ */
+#define LOG_RUNTIME(level, ...) \
+    ::failsafe::logger::log(level, LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__)
+
+/**
+ * @brief Log with runtime-determined level and category
+ * 
+ * @param level Log level (runtime value)
+ * @param category Log category string
+ * @param ... Message arguments
+ */
+#define LOG_CAT_RUNTIME(level, category, ...) \
+    ::failsafe::logger::log(level, category, __FILE__, __LINE__, __VA_ARGS__)
+
+/** @} */ // end of ConditionalLogMacros group
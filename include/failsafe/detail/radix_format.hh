@@ -0,0 +1,210 @@
+/**
+ * @file radix_format.hh
+ * @brief Table and SIMD driven hexadecimal / binary digit rendering
+ *
+ * @details
+ * Low-level converters used by the hex and bin formatters. They write digits
+ * into caller-provided character buffers without touching any stream state:
+ * - hexadecimal digits are produced two at a time from a 256-entry byte table
+ * - binary digits are produced eight at a time with a SWAR multiply/mask
+ *   sequence, or sixteen at a time with SSE2 where available
+ * - byte buffers are rendered to hex sixteen bytes per step with SSE2
+ * - the printable-ASCII column of hex dumps is masked sixteen bytes per step
+ *
+ * Define FAILSAFE_NO_SIMD to force the portable code paths.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <failsafe/detail/simd.hh>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+namespace failsafe::detail {
+
+    /**
+     * @brief Two hex digits for every byte value, lowercase then uppercase
+     */
+    struct hex_byte_table {
+        std::array<char, 512> lower;
+        std::array<char, 512> upper;
+    };
+
+    /**
+     * @internal
+     * @brief Build the byte to hex digit pair table
+     */
+    constexpr hex_byte_table make_hex_byte_table() {
+        constexpr char lower_digits[] = "0123456789abcdef";
+        constexpr char upper_digits[] = "0123456789ABCDEF";
+        hex_byte_table table{};
+        for (std::size_t i = 0; i < 256; ++i) {
+            table.lower[2 * i] = lower_digits[i >> 4];
+            table.lower[2 * i + 1] = lower_digits[i & 0xF];
+            table.upper[2 * i] = upper_digits[i >> 4];
+            table.upper[2 * i + 1] = upper_digits[i & 0xF];
+        }
+        return table;
+    }
+
+    inline constexpr hex_byte_table hex_bytes = make_hex_byte_table();
+
+    /**
+     * @brief Number of significant bits in a value (0 for zero)
+     */
+    inline unsigned significant_bits(std::uint64_t value) noexcept {
+        if (value == 0) {
+            return 0;
+        }
+#if defined(__GNUC__) || defined(__clang__)
+        return 64U - static_cast<unsigned>(__builtin_clzll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return static_cast<unsigned>(index) + 1U;
+#else
+        unsigned bits = 0;
+        while (value) {
+            ++bits;
+            value >>= 1;
+        }
+        return bits;
+#endif
+    }
+
+    /**
+     * @brief Render a value as hex digits without leading zeros
+     *
+     * @param out Destination, at least 16 characters
+     * @param value Value to render
+     * @param uppercase Use A-F instead of a-f
+     * @return Number of digits written (at least 1)
+     */
+    inline std::size_t format_hex_digits(char* out, std::uint64_t value, bool uppercase) noexcept {
+        const char* table = uppercase ? hex_bytes.upper.data() : hex_bytes.lower.data();
+        char digits[16];
+        char* p = digits + sizeof(digits);
+        do {
+            p -= 2;
+            std::memcpy(p, table + 2 * (value & 0xFF), 2);
+            value >>= 8;
+        } while (value != 0);
+
+        auto length = static_cast<std::size_t>(digits + sizeof(digits) - p);
+        // The leading byte may have a zero high nibble
+        if (length > 1 && *p == '0') {
+            ++p;
+            --length;
+        }
+        std::memcpy(out, p, length);
+        return length;
+    }
+
+    /**
+     * @brief Render a byte buffer as contiguous hex digit pairs
+     *
+     * @param out Destination, at least 2 * size characters
+     * @param data Bytes to render
+     * @param size Number of bytes
+     * @param uppercase Use A-F instead of a-f
+     */
+    inline void format_hex_bytes(char* out, const unsigned char* data, std::size_t size, bool uppercase) noexcept {
+        std::size_t i = 0;
+#if FAILSAFE_HAS_SSE2
+        const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+        const __m128i nine = _mm_set1_epi8(9);
+        const __m128i zero_char = _mm_set1_epi8('0');
+        const __m128i letter_gap = _mm_set1_epi8(static_cast<char>(uppercase ? 'A' - '0' - 10 : 'a' - '0' - 10));
+        for (; i + 16 <= size; i += 16) {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            __m128i hi = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble_mask);
+            __m128i lo = _mm_and_si128(bytes, nibble_mask);
+            // nibble + '0', plus the gap to the letters for nibbles above 9
+            hi = _mm_add_epi8(_mm_add_epi8(hi, zero_char), _mm_and_si128(_mm_cmpgt_epi8(hi, nine), letter_gap));
+            lo = _mm_add_epi8(_mm_add_epi8(lo, zero_char), _mm_and_si128(_mm_cmpgt_epi8(lo, nine), letter_gap));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i), _mm_unpacklo_epi8(hi, lo));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+        }
+#endif
+        const char* table = uppercase ? hex_bytes.upper.data() : hex_bytes.lower.data();
+        for (; i < size; ++i) {
+            std::memcpy(out + 2 * i, table + 2 * data[i], 2);
+        }
+    }
+
+    /**
+     * @brief Render the low bits of a value as binary digits, most significant first
+     *
+     * @param out Destination, at least `bits` characters
+     * @param value Value to render
+     * @param bits Number of digits to produce (at most 64)
+     */
+    inline void format_bin_digits(char* out, std::uint64_t value, unsigned bits) noexcept {
+        alignas(16) char digits[64];
+#if FAILSAFE_HAS_SSE2
+        // Lane k of each 16-byte block tests bit (7 - k % 8) of its byte
+        const __m128i bit_mask = _mm_setr_epi8(
+            static_cast<char>(0x80), 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+            static_cast<char>(0x80), 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01);
+        const __m128i zero_char = _mm_set1_epi8('0');
+        for (unsigned block = 0; block < 4; ++block) {
+            const unsigned shift = 48U - 16U * block;
+            const auto hi = static_cast<char>((value >> (shift + 8)) & 0xFF);
+            const auto lo = static_cast<char>((value >> shift) & 0xFF);
+            __m128i lanes = _mm_unpacklo_epi64(_mm_set1_epi8(hi), _mm_set1_epi8(lo));
+            lanes = _mm_cmpeq_epi8(_mm_and_si128(lanes, bit_mask), bit_mask);
+            // Set lanes are -1: '0' - (-1) == '1'
+            _mm_store_si128(reinterpret_cast<__m128i*>(digits + 16 * block), _mm_sub_epi8(zero_char, lanes));
+        }
+#else
+        for (unsigned byte = 0; byte < 8; ++byte) {
+            const std::uint64_t b = (value >> (56U - 8U * byte)) & 0xFF;
+    #if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            constexpr std::uint64_t lane_bits = 0x8040201008040201ULL;
+    #else
+            constexpr std::uint64_t lane_bits = 0x0102040810204080ULL;
+    #endif
+            // Broadcast the byte, keep one bit per lane, turn non-zero lanes into 1
+            std::uint64_t spread = (b * 0x0101010101010101ULL) & lane_bits;
+            spread = ((spread + 0x7F7F7F7F7F7F7F7FULL) >> 7) & 0x0101010101010101ULL;
+            spread += 0x3030303030303030ULL;
+            std::memcpy(digits + 8 * byte, &spread, 8);
+        }
+#endif
+        std::memcpy(out, digits + 64 - bits, bits);
+    }
+
+    /**
+     * @brief Copy bytes, replacing everything outside printable ASCII with '.'
+     *
+     * @param out Destination, at least `size` characters
+     * @param data Bytes to render
+     * @param size Number of bytes
+     */
+    inline void format_printable_ascii(char* out, const unsigned char* data, std::size_t size) noexcept {
+        std::size_t i = 0;
+#if FAILSAFE_HAS_SSE2
+        const __m128i below = _mm_set1_epi8(0x1F);
+        const __m128i above = _mm_set1_epi8(0x7F);
+        const __m128i dot = _mm_set1_epi8('.');
+        for (; i + 16 <= size; i += 16) {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            // Signed compares: bytes >= 0x80 are negative and fail the first test
+            __m128i printable = _mm_and_si128(_mm_cmpgt_epi8(bytes, below), _mm_cmplt_epi8(bytes, above));
+            __m128i result = _mm_or_si128(_mm_and_si128(printable, bytes), _mm_andnot_si128(printable, dot));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), result);
+        }
+#endif
+        for (; i < size; ++i) {
+            const unsigned char c = data[i];
+            out[i] = (c >= 0x20 && c < 0x7F) ? static_cast<char>(c) : '.';
+        }
+    }
+
+} // namespace failsafe::detail
@@ -0,0 +1,120 @@
+/**
+ * @file result_macros.hh
+ * @brief FAILSAFE_ERROR_SITE, STATUS_ERROR and the error propagation macros
+ *
+ * @details
+ * Preprocessor definitions only. Included by result.hh, and by macros.hh
+ * for translation units that use `import failsafe;`.
+ */
+#pragma once
+
+#include <utility>
+
+#include <failsafe/detail/attributes.hh>
+
+/**
+ * @brief The failsafe::error_site of this source line
+ *
+ * A reference to a constant that exists once per call site, so an error
+ * only stores its address. The site id is computed at compile time.
+ *
+ * @param expression String describing the checked expression
+ */
+#define FAILSAFE_ERROR_SITE(expression) \
+    ([]() noexcept -> const ::failsafe::error_site& { \
+        static constexpr ::failsafe::error_site failsafe_error_site_{ \
+            __FILE__, __LINE__, expression, ::failsafe::detail::site_id(__FILE__, __LINE__)}; \
+        return failsafe_error_site_; \
+    }())
+
+/**
+ * @brief A failed failsafe::status reported by this source line
+ *
+ * @param ... An error code (std::error_code or an error code enumeration
+ *            such as std::errc), then optional message arguments, which
+ *            are copied and only formatted by message()
+ *
+ * @example
+ * @code
+ * return STATUS_ERROR(std::errc::timed_out, "No reply from", peer);
+ * @endcode
+ */
+#define STATUS_ERROR(...) \
+    ::failsafe::detail::status_site{FAILSAFE_ERROR_SITE("")}(__VA_ARGS__)
+
+/**
+ * @defgroup PropagationMacros Error Propagation Macros
+ * @brief Return a failure from the calling function
+ *
+ * PROPAGATE_ERROR and ASSIGN_OR_PROPAGATE take a failsafe::result; the
+ * calling function returns a failsafe::result (of any value type) or a
+ * failsafe::error. PROPAGATE_STATUS takes and returns a failsafe::status.
+ * @{
+ */
+
+/**
+ * @brief Return the error of a result from the calling function
+ *
+ * @param ... Expression yielding a failsafe::result; its value is discarded
+ *
+ * @example
+ * @code
+ * failsafe::result<void> start(const config& cfg) {
+ *     PROPAGATE_ERROR(open_port(cfg.port));
+ *     ...
+ *     return {};
+ * }
+ * @endcode
+ */
+#define PROPAGATE_ERROR(...) \
+    do { \
+        auto&& failsafe_result_ = (__VA_ARGS__); \
+        if (FAILSAFE_UNLIKELY(!failsafe_result_.has_value())) { \
+            return failsafe_result_.error(); \
+        } \
+    } while (0)
+
+/** @internal */
+#define FAILSAFE_RESULT_VAR_CONCAT_(prefix, line) prefix##line
+/** @internal */
+#define FAILSAFE_RESULT_VAR_(line) FAILSAFE_RESULT_VAR_CONCAT_(failsafe_result_, line)
+
+/**
+ * @brief Assign the value of a result, or return its error from the
+ *        calling function
+ *
+ * Expands to several statements: use it at block scope, at most once per
+ * line.
+ *
+ * @param lhs Declaration or lvalue receiving the value (moved out)
+ * @param ... Expression yielding a failsafe::result
+ *
+ * @example
+ * @code
+ * failsafe::result<std::size_t> payload_size(const packet& p) {
+ *     ASSIGN_OR_PROPAGATE(auto header, parse_header(p));
+ *     return header.length - header.size;
+ * }
+ * @endcode
+ */
+#define ASSIGN_OR_PROPAGATE(lhs, ...) \
+    auto&& FAILSAFE_RESULT_VAR_(__LINE__) = (__VA_ARGS__); \
+    if (FAILSAFE_UNLIKELY(!FAILSAFE_RESULT_VAR_(__LINE__).has_value())) { \
+        return FAILSAFE_RESULT_VAR_(__LINE__).error(); \
+    } \
+    lhs = *std::move(FAILSAFE_RESULT_VAR_(__LINE__))
+
+/**
+ * @brief Return a failed status from the calling function
+ *
+ * @param ... Expression yielding a failsafe::status
+ */
+#define PROPAGATE_STATUS(...) \
+    do { \
+        ::failsafe::status failsafe_status_ = (__VA_ARGS__); \
+        if (FAILSAFE_UNLIKELY(!failsafe_status_.ok())) { \
+            return failsafe_status_; \
+        } \
+    } while (0)
+
+/** @} */ // end of PropagationMacros group
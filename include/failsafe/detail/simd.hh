@@ -0,0 +1,18 @@
+/**
+ * @file simd.hh
+ * @brief Instruction set detection for the vectorised formatting helpers
+ *
+ * @details
+ * Defines FAILSAFE_HAS_SSE2 to 1 when SSE2 intrinsics are available and
+ * includes `<emmintrin.h>`, otherwise defines it to 0. Define
+ * FAILSAFE_NO_SIMD to force the portable code paths.
+ */
+#pragma once
+
+#if !defined(FAILSAFE_NO_SIMD) && \
+    (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #include <emmintrin.h>
+    #define FAILSAFE_HAS_SSE2 1
+#else
+    #define FAILSAFE_HAS_SSE2 0
+#endif
@@ -0,0 +1,223 @@
+/**
+ * @file stack_trace-inl.hh
+ * @brief Definitions of the stack_trace functions
+ *
+ * @note Included by stack_trace.hh in header-only mode and compiled into
+ *       failsafe_impl otherwise, see export.hh.
+ */
+#pragma once
+
+#include <failsafe/detail/stack_trace.hh>
+#include <failsafe/detail/attributes.hh>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+
+#if defined(_WIN32)
+    #define FAILSAFE_STACK_WALK_WINDOWS 1
+#elif defined(__GNUC__) && (defined(__linux__) || defined(__APPLE__))
+    #define FAILSAFE_STACK_WALK_UNWIND 1
+    #include <cxxabi.h>
+    #include <dlfcn.h>
+    #include <pthread.h>
+    #include <unwind.h>
+    #if defined(__x86_64__) || defined(__aarch64__)
+        #define FAILSAFE_STACK_WALK_FRAME_POINTERS 1
+    #endif
+#endif
+
+#if defined(FAILSAFE_STACK_WALK_WINDOWS)
+// From <windows.h>, declared here to keep it out of header-only builds
+extern "C" __declspec(dllimport) unsigned short __stdcall RtlCaptureStackBackTrace(
+    unsigned long frames_to_skip, unsigned long frames_to_capture, void** back_trace, unsigned long* hash);
+#endif
+
+namespace failsafe::detail {
+
+    namespace stack_trace_internal {
+#if defined(FAILSAFE_STACK_WALK_FRAME_POINTERS)
+        /**
+         * @brief Address range of the calling thread's stack; empty if unknown
+         */
+        struct stack_bounds {
+            const char* low = nullptr;
+            const char* high = nullptr;
+        };
+
+        FAILSAFE_INLINE stack_bounds current_stack_bounds() noexcept {
+            stack_bounds bounds;
+#if defined(__APPLE__)
+            pthread_t self = pthread_self();
+            bounds.high = static_cast<const char*>(pthread_get_stackaddr_np(self));
+            bounds.low = bounds.high - pthread_get_stacksize_np(self);
+#else
+            pthread_attr_t attr;
+            if (pthread_getattr_np(pthread_self(), &attr) == 0) {
+                void* address = nullptr;
+                std::size_t size = 0;
+                if (pthread_attr_getstack(&attr, &address, &size) == 0) {
+                    bounds.low = static_cast<const char*>(address);
+                    bounds.high = bounds.low + size;
+                }
+                pthread_attr_destroy(&attr);
+            }
+#endif
+            return bounds;
+        }
+#endif
+
+#if defined(FAILSAFE_STACK_WALK_UNWIND)
+        struct unwind_state {
+            void** frames;
+            std::size_t size;
+            std::size_t skip;
+        };
+
+        FAILSAFE_INLINE _Unwind_Reason_Code unwind_frame(_Unwind_Context* context, void* arg) {
+            auto* state = static_cast<unwind_state*>(arg);
+            if (state->skip > 0) {
+                --state->skip;
+                return _URC_NO_REASON;
+            }
+            auto ip = _Unwind_GetIP(context);
+            if (ip == 0) {
+                return _URC_END_OF_STACK;
+            }
+            state->frames[state->size++] = reinterpret_cast<void*>(ip);
+            return state->size < stack_trace::max_frames ? _URC_NO_REASON : _URC_END_OF_STACK;
+        }
+#endif
+
+        /**
+         * @brief Resolve one return address
+         */
+        FAILSAFE_INLINE std::string symbolize(const void* address) {
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "0x%zx", static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(address)));
+            std::string text(buffer);
+#if defined(FAILSAFE_STACK_WALK_UNWIND)
+            // A return address may be just past the end of the calling function
+            const char* call = static_cast<const char*>(address) - 1;
+            Dl_info info;
+            if (dladdr(call, &info) == 0) {
+                return text;
+            }
+            if (info.dli_sname != nullptr) {
+                int status = 0;
+                char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+                text = status == 0 && demangled != nullptr ? demangled : info.dli_sname;
+                std::free(demangled);
+                std::snprintf(buffer, sizeof(buffer), "+0x%zx",
+                              static_cast<std::size_t>(static_cast<const char*>(address) -
+                                                       static_cast<const char*>(info.dli_saddr)));
+                text += buffer;
+            }
+            if (info.dli_fname != nullptr) {
+                std::snprintf(buffer, sizeof(buffer), "+0x%zx",
+                              static_cast<std::size_t>(static_cast<const char*>(address) -
+                                                       static_cast<const char*>(info.dli_fbase)));
+                text += " (";
+                text += info.dli_fname;
+                text += buffer;
+                text += ")";
+            }
+#endif
+            return text;
+        }
+    } // namespace stack_trace_internal
+
+    FAILSAFE_INLINE FAILSAFE_NOINLINE void stack_trace::capture_frame_pointers(std::size_t skip) noexcept {
+#if defined(FAILSAFE_STACK_WALK_FRAME_POINTERS)
+        static thread_local const stack_trace_internal::stack_bounds bounds =
+            stack_trace_internal::current_stack_bounds();
+
+        // Frame record: the caller's frame pointer, then the return address
+        const std::size_t skipped = skip;
+        size_ = 0;
+        auto* frame = static_cast<void* const*>(__builtin_frame_address(0));
+        while (size_ < max_frames) {
+            const auto* record = reinterpret_cast<const char*>(frame);
+            if (record < bounds.low || record + 2 * sizeof(void*) > bounds.high ||
+                reinterpret_cast<std::uintptr_t>(record) % sizeof(void*) != 0) {
+                break;
+            }
+            void* return_address = frame[1];
+            auto* next = static_cast<void* const*>(frame[0]);
+            if (return_address == nullptr) {
+                break;
+            }
+            if (skip > 0) {
+                --skip;
+            } else {
+                frames_[size_++] = return_address;
+            }
+            if (next <= frame) {
+                break;
+            }
+            frame = next;
+        }
+        if (size_ == 0) {
+            capture_unwinder(skipped + 1);
+        }
+#else
+        capture_unwinder(skip + 1);
+#endif
+    }
+
+    FAILSAFE_INLINE FAILSAFE_NOINLINE void stack_trace::capture_unwinder(std::size_t skip) noexcept {
+#if defined(FAILSAFE_STACK_WALK_WINDOWS)
+        size_ = RtlCaptureStackBackTrace(static_cast<unsigned long>(skip + 1), static_cast<unsigned long>(max_frames),
+                                         frames_, nullptr);
+#elif defined(FAILSAFE_STACK_WALK_UNWIND)
+        // The first frame is this function's call of _Unwind_Backtrace
+        stack_trace_internal::unwind_state state{frames_, 0, skip + 1};
+        _Unwind_Backtrace(&stack_trace_internal::unwind_frame, &state);
+        size_ = state.size;
+#else
+        (void)skip;
+        size_ = 0;
+#endif
+    }
+
+    FAILSAFE_INLINE void stack_trace::start_at(const void* return_address) noexcept {
+        if (return_address == nullptr) {
+            return;
+        }
+        for (std::size_t i = 0; i < size_; ++i) {
+            if (frames_[i] == return_address) {
+                std::copy(frames_ + i, frames_ + size_, frames_);
+                size_ -= i;
+                return;
+            }
+        }
+    }
+
+    FAILSAFE_INLINE void stack_trace::append_to(std::string& out, unsigned int indent_level) const {
+        if (size_ == 0) {
+            return;
+        }
+
+        // Resolved addresses of the process; code addresses are few and stable
+        static std::mutex mutex;
+        static std::unordered_map <const void*, std::string> symbols;
+
+        std::lock_guard <std::mutex> lock(mutex);
+        for (std::size_t i = 0; i < size_; ++i) {
+            auto entry = symbols.find(frames_[i]);
+            if (entry == symbols.end()) {
+                entry = symbols.emplace(frames_[i], stack_trace_internal::symbolize(frames_[i])).first;
+            }
+            out.append(indent_level * 2u, ' ');
+            out += '#';
+            out += std::to_string(i);
+            out += ' ';
+            out += entry->second;
+            out += '\n';
+        }
+    }
+
+} // namespace failsafe::detail
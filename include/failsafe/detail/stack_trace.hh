@@ -0,0 +1,102 @@
+/**
+ * @file stack_trace.hh
+ * @brief Raw return addresses, captured cheaply and symbolized on demand
+ *
+ * @details
+ * A stack_trace holds up to max_frames return addresses in a fixed array.
+ * Capturing only walks the stack; resolving the addresses to function and
+ * module names happens when the trace is printed, through a per-process
+ * cache, so each address is looked up once.
+ *
+ * Two ways to walk the stack:
+ * - capture_frame_pointers(): follows the frame pointer chain, bounded by
+ *   the thread's stack. Tens of nanoseconds, but only complete for code
+ *   compiled with frame pointers (-fno-omit-frame-pointer); x86-64 and
+ *   AArch64 with GCC or Clang on Linux and macOS, the unwinder elsewhere.
+ * - capture_unwinder(): the unwind tables (_Unwind_Backtrace). Works
+ *   without frame pointers; about 0.2 us per frame.
+ *
+ * On Windows both use RtlCaptureStackBackTrace, and frames are printed as
+ * addresses.
+ *
+ * Used by THROW, see failsafe::exception::set_stack_capture().
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include <failsafe/detail/export.hh>
+
+namespace failsafe::detail {
+
+    /**
+     * @brief Return addresses of a call stack
+     */
+    class FAILSAFE_API stack_trace {
+        public:
+            /** @brief Frames kept at most; deeper frames are dropped */
+            static constexpr std::size_t max_frames = 32;
+
+            /** @brief Empty trace */
+            stack_trace() noexcept = default;
+
+            /**
+             * @brief Capture the caller's stack through frame pointers
+             *
+             * @param skip Innermost frames to leave out; 0 starts at the caller
+             */
+            void capture_frame_pointers(std::size_t skip = 0) noexcept;
+
+            /**
+             * @brief Capture the caller's stack through the unwind tables
+             *
+             * @param skip Innermost frames to leave out; 0 starts at the caller
+             */
+            void capture_unwinder(std::size_t skip = 0) noexcept;
+
+            /**
+             * @brief Drop the frames called from the one returning to
+             *        `return_address`, which becomes frame 0
+             *
+             * Keeps all frames if `return_address` is null or not captured.
+             */
+            void start_at(const void* return_address) noexcept;
+
+            /** @brief Whether no frames were captured */
+            bool empty() const noexcept {
+                return size_ == 0;
+            }
+
+            /** @brief Number of captured frames */
+            std::size_t size() const noexcept {
+                return size_;
+            }
+
+            /** @brief Return address of frame i, innermost first */
+            const void* operator[](std::size_t i) const noexcept {
+                return frames_[i];
+            }
+
+            /**
+             * @brief Append one line per frame: "#<n> <function>+<offset> (<module>+<offset>)"
+             *
+             * Names come from the dynamic symbol table (dladdr): functions of
+             * the executable are only named when it is linked with -rdynamic,
+             * others show the module offset, for addr2line.
+             *
+             * @param out Output string
+             * @param indent_level Indentation in steps of two spaces
+             */
+            void append_to(std::string& out, unsigned int indent_level) const;
+
+        private:
+            std::size_t size_ = 0;
+            void* frames_[max_frames]; // only [0, size_) is initialized
+    };
+
+} // namespace failsafe::detail
+
+#ifdef FAILSAFE_HEADER_ONLY
+#include <failsafe/detail/stack_trace-inl.hh>
+#endif
@@ -16,6 +16,10 @@
 #include <ctime>
 #include <algorithm>
 #include <cctype>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <tuple>
 #include <vector>
 #include <array>
@@ -26,38 +30,35 @@
 #include <unordered_set>
 #include <unordered_map>
 
-// Include utf8cpp for wstring conversion
-// Suppress sign conversion warnings from utf8.h template instantiations
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable: 4365) // signed/unsigned mismatch
-#elif defined(__clang__)
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wsign-conversion"
-#pragma clang diagnostic ignored "-Wswitch-default"
-#elif defined(__GNUC__)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wsign-conversion"
-#pragma GCC diagnostic ignored "-Wswitch-default"
-#endif
-
-#include <utf8.h>
+#include <failsafe/detail/case_transform.hh>
+#include <failsafe/detail/radix_format.hh>
+#include <failsafe/detail/timestamp_format.hh>
+#include <failsafe/detail/utf8_transcode.hh>
 
-#ifdef _MSC_VER
-#pragma warning(pop)
-#elif defined(__clang__)
-#pragma clang diagnostic pop
-#elif defined(__GNUC__)
-#pragma GCC diagnostic pop
-#endif
+#include <failsafe/detail/features.hh>
 
-// C++20 feature detection
-#if __cplusplus >= 202002L
+#if FAILSAFE_HAS_CONCEPTS
     #include <concepts>
     #include <ranges>
-    #define FAILSAFE_HAS_CONCEPTS 1
-#else
-    #define FAILSAFE_HAS_CONCEPTS 0
+    #include <span>
+#endif
+
+/**
+ * @name Formatting engines
+ * Selected with FAILSAFE_FORMAT_ENGINE (CMake: NEUTRINO_FAILSAFE_FORMAT_ENGINE).
+ * The default iostream engine builds messages in a std::ostringstream; the
+ * std::format and {fmt} engines render built-in types straight into a reusable
+ * per-thread character buffer and only fall back to append_to_stream() for
+ * types that are printable solely via operator<<. Output is identical.
+ * @{
+ */
+#define FAILSAFE_FORMAT_ENGINE_IOSTREAM 0 ///< std::ostringstream (default)
+#define FAILSAFE_FORMAT_ENGINE_STD 1      ///< std::format (C++20)
+#define FAILSAFE_FORMAT_ENGINE_FMT 2      ///< {fmt} library
+/** @} */
+
+#ifndef FAILSAFE_FORMAT_ENGINE
+    #define FAILSAFE_FORMAT_ENGINE FAILSAFE_FORMAT_ENGINE_IOSTREAM
 #endif
 
 // Compatibility helpers for C++17
@@ -70,34 +71,6 @@ namespace std {
 
 namespace failsafe::detail {
 
-    /**
-     * @brief Thread-safe wrapper for gmtime
-     * @param time Pointer to time_t value
-     * @param result Pointer to tm struct to store result
-     * @return Pointer to result on success, nullptr on failure
-     */
-    inline std::tm* safe_gmtime(const std::time_t* time, std::tm* result) {
-#ifdef _WIN32
-        return gmtime_s(result, time) == 0 ? result : nullptr;
-#else
-        return gmtime_r(time, result);
-#endif
-    }
-
-    /**
-     * @brief Thread-safe wrapper for localtime
-     * @param time Pointer to time_t value
-     * @param result Pointer to tm struct to store result
-     * @return Pointer to result on success, nullptr on failure
-     */
-    inline std::tm* safe_localtime(const std::time_t* time, std::tm* result) {
-#ifdef _WIN32
-        return localtime_s(result, time) == 0 ? result : nullptr;
-#else
-        return localtime_r(time, result);
-#endif
-    }
-
     /**
      * @brief Type traits for type-safe formatting (C++17/20 compatible)
      */
@@ -126,8 +99,9 @@ namespace failsafe::detail {
     /**
      * @brief Format wrapper for uppercase output
      *
-     * This formatter converts the output to uppercase. It works with any type
-     * and applies the transformation to the string representation.
+     * This formatter converts the output to uppercase. It works with any type:
+     * the value is rendered into the output as usual and its characters are
+     * then converted in place (UTF-8 aware, see case_transform.hh).
      *
      * @tparam T The type of value to format
      */
@@ -140,8 +114,9 @@ namespace failsafe::detail {
     /**
      * @brief Format wrapper for lowercase output
      *
-     * This formatter converts the output to lowercase. It works with any type
-     * and applies the transformation to the string representation.
+     * This formatter converts the output to lowercase. It works with any type:
+     * the value is rendered into the output as usual and its characters are
+     * then converted in place (UTF-8 aware, see case_transform.hh).
      *
      * @tparam T The type of value to format
      */
@@ -233,8 +208,13 @@ namespace failsafe::detail {
     template<typename T>
     inline auto uppercase(T&& value) {
         if constexpr (std::is_array_v <std::remove_reference_t <T>>) {
-            // For string literals and arrays, convert to string
-            return uppercase_format <std::string>{std::string(value)};
+            // String literals and arrays are referenced, not copied
+            using char_type = std::remove_cv_t <std::remove_extent_t <std::remove_reference_t <T>>>;
+            if constexpr (std::is_same_v <char_type, wchar_t>) {
+                return uppercase_format <std::wstring_view>{value};
+            } else {
+                return uppercase_format <std::decay_t <T>>{value};
+            }
         } else {
             return uppercase_format <std::remove_cvref_t <T>>{std::forward <T>(value)};
         }
@@ -254,8 +234,13 @@ namespace failsafe::detail {
     template<typename T>
     inline auto lowercase(T&& value) {
         if constexpr (std::is_array_v <std::remove_reference_t <T>>) {
-            // For string literals and arrays, convert to string
-            return lowercase_format <std::string>{std::string(value)};
+            // String literals and arrays are referenced, not copied
+            using char_type = std::remove_cv_t <std::remove_extent_t <std::remove_reference_t <T>>>;
+            if constexpr (std::is_same_v <char_type, wchar_t>) {
+                return lowercase_format <std::wstring_view>{value};
+            } else {
+                return lowercase_format <std::decay_t <T>>{value};
+            }
         } else {
             return lowercase_format <std::remove_cvref_t <T>>{std::forward <T>(value)};
         }
@@ -478,18 +463,22 @@ namespace failsafe::detail {
      * This formatter outputs containers (vector, list, set, map, etc.) with
      * customizable formatting options like size limits, starting index, delimiters.
      *
-     * @tparam T The container type
+     * Containers passed as lvalues are referenced rather than copied, so
+     * `container(v, 10)` does not depend on the size of `v`; temporaries are
+     * moved into the wrapper.
+     *
+     * @tparam T The container type, or a const reference to it
      */
     template<typename T
 #if FAILSAFE_HAS_CONCEPTS
-        > requires container_like<T>
+        > requires container_like<std::remove_cvref_t<T>>
 #else
-        , typename = std::enable_if_t<container_like_v<T>>
+        , typename = std::enable_if_t<container_like_v<std::remove_cvref_t<T>>>
         >
 #endif
     struct container_format {
-        using value_type = T;
-        T value;
+        using value_type = std::remove_cvref_t<T>;
+        T value; ///< The container (const reference for lvalue arguments)
         std::size_t max_items = std::numeric_limits <std::size_t>::max(); ///< Maximum items to show
         std::size_t start_index = 0; ///< Starting index (0-based)
         std::string_view prefix = "["; ///< Container prefix
@@ -501,6 +490,15 @@ namespace failsafe::detail {
         std::string_view indent = "  "; ///< Indentation for multiline
     };
 
+    /**
+     * @internal
+     * @brief Storage used by container(): a const reference for lvalues, a value for temporaries
+     */
+    template<typename T>
+    using container_held_t = std::conditional_t<std::is_lvalue_reference_v<T>,
+                                                const std::remove_cvref_t<T>&,
+                                                std::remove_cvref_t<T>>;
+
     /**
      * @brief Factory function to create container formatter
      *
@@ -523,7 +521,7 @@ namespace failsafe::detail {
         >
 #endif
     inline auto container(T&& value, std::size_t max_items = 0) {
-        return container_format<std::remove_cvref_t<T>>{
+        return container_format<container_held_t<T>>{
             std::forward<T>(value),
             max_items == 0 ? std::numeric_limits <std::size_t>::max() : max_items
         };
@@ -549,15 +547,15 @@ namespace failsafe::detail {
      */
     template<typename T, typename ConfigFunc
 #if FAILSAFE_HAS_CONCEPTS
-        > requires container_like<T> && std::invocable<ConfigFunc, container_format<std::remove_cvref_t<T>>&>
+        > requires container_like<T> && std::invocable<ConfigFunc, container_format<container_held_t<T>>&>
 #else
         , typename = std::enable_if_t<
             container_like_v<T> && 
-            std::is_invocable_v<ConfigFunc, container_format<std::remove_cvref_t<T>>&>
+            std::is_invocable_v<ConfigFunc, container_format<container_held_t<T>>&>
         >>
 #endif
     inline auto container(T&& value, ConfigFunc&& config) {
-        container_format<std::remove_cvref_t<T>> fmt{std::forward<T>(value)};
+        container_format<container_held_t<T>> fmt{std::forward<T>(value)};
         std::forward<ConfigFunc>(config)(fmt);
         return fmt;
     }
@@ -589,83 +587,305 @@ namespace failsafe::detail {
         return bin_format<std::remove_cvref_t<T>>{std::forward<T>(value), width, show_base, group_size};
     }
 
-    // Forward declaration of the main append_to_stream template
-    template<typename T>
-    void append_to_stream(std::ostringstream& oss, T&& value);
+    /**
+     * @brief Layout options for hexdump()
+     */
+    struct hexdump_options {
+        std::size_t width = 16; ///< Bytes per line (clamped to 1..64)
+        std::size_t max_bytes = 0; ///< Dump at most this many bytes (0 = no limit)
+        bool show_ascii = true; ///< Append the printable-ASCII column
+        bool uppercase = false; ///< Use A-F instead of a-f
+        std::size_t base_offset = 0; ///< Offset printed for the first byte
+    };
 
     /**
-     * @brief Append hexadecimal formatted value to stream
+     * @brief Format wrapper for hex dumps of raw memory
+     *
+     * Non-owning: the referenced bytes must outlive the message being built,
+     * which is always the case when the wrapper is passed straight to a
+     * logging or exception macro.
+     */
+    struct hexdump_format {
+        const unsigned char* data; ///< First byte to dump
+        std::size_t size; ///< Number of bytes available
+        hexdump_options options; ///< Layout options
+    };
+
+    /**
+     * @brief Factory function to create a hex dump formatter for raw memory
+     *
+     * Produces the classic offset / hex / ASCII layout, one line per
+     * `options.width` bytes, separated by newlines (no trailing newline):
+     *
+     * @code
+     * set_error("Packet:\n", hexdump(buf, len));
+     * // Packet:
+     * // 00000000  47 45 54 20 2f 20 48 54  54 50 2f 31 2e 31 0d 0a  |GET / HTTP/1.1..|
+     * // 00000010  48 6f 73 74 3a 20 61                              |Host: a|
+     * @endcode
+     *
+     * @param data Start of the memory to dump
+     * @param size Number of bytes
+     * @param options Layout options
+     * @return hexdump_format wrapper
      */
+    inline hexdump_format hexdump(const void* data, std::size_t size, hexdump_options options = {}) {
+        return hexdump_format{static_cast<const unsigned char*>(data), size, options};
+    }
+
+    /**
+     * @brief Factory function to create a hex dump formatter for a byte container
+     *
+     * Accepts any contiguous container of byte-sized elements, e.g.
+     * `std::vector<std::uint8_t>`, `std::array<std::byte, N>` or `std::string`.
+     */
+    template<typename Container
 #if FAILSAFE_HAS_CONCEPTS
-    template<typename T>
-    void append_to_stream(std::ostringstream& oss, const hex_format<T>& fmt) {
+        > requires requires(const Container& c) {
+            { std::data(c) } -> std::convertible_to<const void*>;
+            { std::size(c) } -> std::convertible_to<std::size_t>;
+            requires sizeof(*std::data(c)) == 1;
+        }
 #else
-    template<typename T, typename Enable>
-    void append_to_stream(std::ostringstream& oss, const hex_format<T, Enable>& fmt) {
+        , typename = std::enable_if_t<
+            std::is_convertible_v<decltype(std::data(std::declval<const Container&>())), const void*> &&
+            sizeof(*std::data(std::declval<const Container&>())) == 1
+        >>
 #endif
-        auto flags = oss.flags();
+    inline hexdump_format hexdump(const Container& bytes, hexdump_options options = {}) {
+        return hexdump(static_cast<const void*>(std::data(bytes)), std::size(bytes), options);
+    }
 
-        // Handle base prefix
-        if (fmt.show_base) {
 #if FAILSAFE_HAS_CONCEPTS
-            if constexpr (pointer_formattable<T>) {
-#else
-            if constexpr (pointer_formattable_v<T>) {
+    /**
+     * @brief Factory function to create a hex dump formatter for a byte span
+     */
+    inline hexdump_format hexdump(std::span<const std::byte> bytes, hexdump_options options = {}) {
+        return hexdump(static_cast<const void*>(bytes.data()), bytes.size(), options);
+    }
 #endif
-                if (fmt.value != nullptr) {
-                    oss << "0x";
-                }
-            } else {
-                // Don't show prefix for zero with no width
-                if (fmt.value != 0 || fmt.width > 0) {
-                    oss << "0x";
-                }
-            }
+
+    // Forward declaration of the main append_to_stream template
+    template<typename T>
+    void append_to_stream(std::ostringstream& oss, T&& value);
+
+    /**
+     * @brief Write raw characters to an output sink
+     *
+     * Renderers shared by the iostream path and the format engines are
+     * templated on the sink and write through these overloads.
+     */
+    inline void sink_write(std::ostringstream& oss, std::string_view text) {
+        oss.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+
+    /**
+     * @brief Write raw characters to a string buffer sink
+     */
+    inline void sink_write(std::string& out, std::string_view text) {
+        out.append(text.data(), text.size());
+    }
+
+    /**
+     * @internal
+     * @brief Access to the put area of a std::stringbuf
+     *
+     * Goes through pointers to the protected std::streambuf members, which
+     * a derived class may form for any stream buffer object.
+     */
+    struct stringbuf_put_area : std::stringbuf {
+        static char* begin(std::stringbuf& buf) { return (buf.*&stringbuf_put_area::pbase)(); }
+        static char* end(std::stringbuf& buf) { return (buf.*&stringbuf_put_area::pptr)(); }
+    };
+
+    /**
+     * @brief Number of characters written to a stream sink so far
+     */
+    inline std::size_t sink_position(std::ostringstream& oss) {
+        std::stringbuf& buf = *oss.rdbuf();
+        return static_cast<std::size_t>(stringbuf_put_area::end(buf) - stringbuf_put_area::begin(buf));
+    }
+
+    /**
+     * @brief Number of characters written to a string buffer sink so far
+     */
+    inline std::size_t sink_position(std::string& out) {
+        return out.size();
+    }
+
+    /**
+     * @brief Convert the case of everything written to a stream sink since `from`
+     *
+     * Works directly on the characters in the stream buffer.
+     */
+    template<letter_case Case>
+    void sink_transform_case(std::ostringstream& oss, std::size_t from) {
+        std::stringbuf& buf = *oss.rdbuf();
+        char* begin = stringbuf_put_area::begin(buf) + from;
+        transform_case<Case>(begin, static_cast<std::size_t>(stringbuf_put_area::end(buf) - begin));
+    }
+
+    /**
+     * @brief Convert the case of everything written to a string buffer sink since `from`
+     */
+    template<letter_case Case>
+    void sink_transform_case(std::string& out, std::size_t from) {
+        transform_case<Case>(out.data() + from, out.size() - from);
+    }
+
+    /**
+     * @brief Write a prefix and digits to a sink, separating groups with spaces
+     *
+     * The digit sequence is `zeros` '0' characters followed by `count`
+     * characters from `digits`; a space is inserted after every `group`
+     * digits counted from the start (no grouping when group is 0). Output is
+     * assembled in a stack buffer so short values take a single sink write.
+     */
+    template<typename Sink>
+    void sink_write_digits(Sink& out, std::string_view prefix, std::size_t zeros,
+                           const char* digits, std::size_t count, std::size_t group = 0) {
+        if (group == 0) {
+            group = std::numeric_limits<std::size_t>::max();
         }
 
-        // Set hex formatting
-        oss << std::hex;
-        if (fmt.uppercase) {
-            oss << std::uppercase;
+        char buffer[256];
+        std::size_t used = 0;
+        if (prefix.size() <= sizeof(buffer) / 2) {
+            std::memcpy(buffer, prefix.data(), prefix.size());
+            used = prefix.size();
+        } else {
+            sink_write(out, prefix);
+        }
+        std::size_t emitted = 0;
+        std::size_t in_group = 0;
+        const std::size_t total = zeros + count;
+        while (emitted < total) {
+            // Keep room for a separator and at least one digit
+            if (used + 2 > sizeof(buffer)) {
+                sink_write(out, std::string_view(buffer, used));
+                used = 0;
+            }
+            if (in_group == group) {
+                buffer[used++] = ' ';
+                in_group = 0;
+            }
+            const std::size_t chunk = std::min({group - in_group, total - emitted, sizeof(buffer) - used});
+            // Leading zeros first, then the rendered digits
+            const std::size_t from_zeros = emitted < zeros ? std::min(chunk, zeros - emitted) : 0;
+            std::memset(buffer + used, '0', from_zeros);
+            if (chunk > from_zeros) {
+                std::memcpy(buffer + used + from_zeros, digits + (emitted + from_zeros - zeros), chunk - from_zeros);
+            }
+            used += chunk;
+            emitted += chunk;
+            in_group += chunk;
         }
+        sink_write(out, std::string_view(buffer, used));
+    }
 
-        // Set width and fill
-        if (fmt.width > 0) {
-            oss << std::setw(static_cast<int>(fmt.width)) << std::setfill('0');
+    /**
+     * @brief Write UTF-16 or UTF-32 code units to a sink as UTF-8
+     *
+     * Converts through a stack buffer, so no intermediate string is built.
+     * Malformed input is written as U+FFFD (see utf8_transcode.hh).
+     */
+    template<typename Sink, typename CharT>
+    void sink_write_utf8(Sink& out, const CharT* data, std::size_t size) {
+        char buffer[512];
+        while (size > 0) {
+            const utf8_transcode_result result = transcode_to_utf8(data, size, buffer, sizeof(buffer));
+            sink_write(out, std::string_view(buffer, result.written));
+            data += result.consumed;
+            size -= result.consumed;
         }
+    }
+
+    /**
+     * @brief Write a time point to a sink as an ISO 8601 UTC timestamp
+     *
+     * Renders "YYYY-MM-DDTHH:MM:SS.fffZ" with FAILSAFE_TIMESTAMP_PRECISION
+     * fractional digits (see timestamp_format.hh).
+     */
+    template<typename Sink>
+    void sink_write_timestamp(Sink& out, std::chrono::system_clock::time_point tp) {
+        char buffer[timestamp_max_length + 1];
+        std::size_t used = format_timestamp(buffer, tp);
+        buffer[used++] = 'Z';
+        sink_write(out, std::string_view(buffer, used));
+    }
+
+    /**
+     * @brief Format a value into a stream sink
+     */
+    template<typename T>
+    void sink_append(std::ostringstream& oss, T&& value) {
+        append_to_stream(oss, std::forward<T>(value));
+    }
+
+#if FAILSAFE_FORMAT_ENGINE != FAILSAFE_FORMAT_ENGINE_IOSTREAM
+    // Forward declaration of the format engine entry point (see format_engine.hh)
+    template<typename T>
+    void append_to_buffer(std::string& out, const T& value);
+
+    /**
+     * @brief Format a value into a string buffer sink
+     */
+    template<typename T>
+    void sink_append(std::string& out, T&& value) {
+        append_to_buffer(out, value);
+    }
+#endif
+
+    /**
+     * @brief Render a hexadecimal formatted value into a sink
+     *
+     * Digits come from the byte table in radix_format.hh; no stream state is
+     * involved, so the stream and format engine paths share this renderer.
+     */
+    template<typename Sink, typename Format>
+    void render_hex(Sink& out, const Format& fmt) {
+        using T = typename Format::value_type;
+        std::uint64_t value;
+        bool prefix;
 
-        // Output value
 #if FAILSAFE_HAS_CONCEPTS
         if constexpr (pointer_formattable<T>) {
 #else
         if constexpr (pointer_formattable_v<T>) {
 #endif
             if (fmt.value == nullptr) {
-                oss.flags(flags); // Restore before outputting
-                oss << "nullptr";
+                sink_write(out, "nullptr");
                 return;
             }
-            oss << reinterpret_cast<std::uintptr_t>(fmt.value);
+            value = reinterpret_cast<std::uintptr_t>(fmt.value);
+            prefix = fmt.show_base;
         } else {
-            // For signed types, cast to unsigned to avoid negative hex
-            if constexpr (std::is_signed_v <T>) {
-                // Cast to int for proper display (avoid char interpretation)
-                if constexpr (sizeof(T) == 1) {
-                    oss << static_cast <unsigned int>(static_cast <std::make_unsigned_t <T>>(fmt.value));
-                } else {
-                    oss << static_cast <std::make_unsigned_t <T>>(fmt.value);
-                }
+            if constexpr (std::is_same_v<T, bool>) {
+                value = fmt.value ? 1U : 0U;
             } else {
-                // Cast to int for proper display (avoid char interpretation)
-                if constexpr (sizeof(T) == 1) {
-                    oss << static_cast <unsigned int>(fmt.value);
-                } else {
-                    oss << fmt.value;
-                }
+                // For signed types, cast to unsigned to avoid negative hex
+                value = static_cast<std::make_unsigned_t<T>>(fmt.value);
             }
+            // Don't show prefix for zero with no width
+            prefix = fmt.show_base && (value != 0 || fmt.width > 0);
         }
 
-        oss.flags(flags); // Restore flags
+        char digits[16];
+        const std::size_t count = format_hex_digits(digits, value, fmt.uppercase);
+        sink_write_digits(out, prefix ? "0x" : "", fmt.width > count ? fmt.width - count : 0, digits, count);
+    }
+
+    /**
+     * @brief Append hexadecimal formatted value to stream
+     */
+#if FAILSAFE_HAS_CONCEPTS
+    template<typename T>
+    void append_to_stream(std::ostringstream& oss, const hex_format<T>& fmt) {
+#else
+    template<typename T, typename Enable>
+    void append_to_stream(std::ostringstream& oss, const hex_format<T, Enable>& fmt) {
+#endif
+        render_hex(oss, fmt);
     }
 
     /**
@@ -714,6 +934,30 @@ namespace failsafe::detail {
         oss.flags(flags); // Restore flags
     }
 
+    /**
+     * @brief Render a binary formatted value into a sink
+     */
+    template<typename Sink, typename Format>
+    void render_bin(Sink& out, const Format& fmt) {
+        using T = typename Format::value_type;
+
+        // Convert to unsigned for bit operations
+        using UnsignedT = std::make_unsigned_t <T>;
+        const auto uvalue = static_cast <std::uint64_t>(static_cast <UnsignedT>(fmt.value));
+
+        // Show `width` bits, or up to the highest set bit (at least one digit)
+        std::size_t bits_to_show = fmt.width;
+        if (bits_to_show == 0) {
+            bits_to_show = std::max(significant_bits(uvalue), 1U);
+        }
+
+        // Bits above the value's width render as leading zeros
+        const auto rendered = static_cast<unsigned>(std::min<std::size_t>(bits_to_show, 64));
+        char digits[64];
+        format_bin_digits(digits, uvalue, rendered);
+        sink_write_digits(out, fmt.show_base ? "0b" : "", bits_to_show - rendered, digits, rendered, fmt.group_size);
+    }
+
     /**
      * @brief Append binary formatted value to stream
      */
@@ -724,43 +968,7 @@ namespace failsafe::detail {
     template<typename T, typename Enable>
     void append_to_stream(std::ostringstream& oss, const bin_format<T, Enable>& fmt) {
 #endif
-        // Handle base prefix
-        if (fmt.show_base) {
-            oss << "0b";
-        }
-
-        // Convert to unsigned for bit operations
-        using UnsignedT = std::make_unsigned_t <T>;
-        auto uvalue = static_cast <UnsignedT>(fmt.value);
-
-        // Calculate number of bits
-        constexpr int total_bits = sizeof(T) * 8;
-        int bits_to_show = fmt.width > 0 ? static_cast<int>(fmt.width) : total_bits;
-
-        // Find the highest set bit if width is 0
-        if (fmt.width == 0 && uvalue != 0) {
-            bits_to_show = 0;
-            auto temp = uvalue;
-            while (temp) {
-                bits_to_show++;
-                temp >>= 1;
-            }
-        } else if (fmt.width == 0 && uvalue == 0) {
-            bits_to_show = 1; // Show at least one bit for zero
-        }
-
-        // Output bits
-        std::string bit_string;
-        size_t bit_count = 0;
-        for (int i = bits_to_show - 1; i >= 0; --i) {
-            if (bit_count > 0 && fmt.group_size > 0 && bit_count % fmt.group_size == 0) {
-                bit_string += ' ';
-            }
-            bit_string += ((uvalue >> i) & 1) ? '1' : '0';
-            bit_count++;
-        }
-
-        oss << bit_string;
+        render_bin(oss, fmt);
     }
 
     // Add overloads for non-const lvalue references
@@ -858,107 +1066,221 @@ namespace failsafe::detail {
     }
 
     /**
-     * @brief Helper to get container size if available
+     * @brief Element types rendered by the batched numeric fast path
+     *
+     * Integers (not bool or character types, which print as text) and, where
+     * the standard library provides floating-point std::to_chars, floats.
+     */
+    template<typename T>
+    inline constexpr bool batch_numeric_v =
+        (std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char> &&
+         !std::is_same_v<T, signed char> && !std::is_same_v<T, unsigned char> &&
+         !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>)
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        || std::is_floating_point_v<T>
+#endif
+        ;
+
+    /**
+     * @brief Detect contiguous containers of batch-renderable numbers
      */
+    template<typename Container, typename = void>
+    struct is_contiguous_numeric : std::false_type {};
+
     template<typename Container>
-    inline std::size_t get_container_size(const Container& c) {
-#if FAILSAFE_HAS_CONCEPTS
-        if constexpr (has_size<Container>) {
-            return c.size();
-        } else {
-            // For containers without size() like forward_list, count elements
-            return std::distance(c.begin(), c.end());
+    struct is_contiguous_numeric<Container, std::void_t<
+        typename Container::value_type,
+        decltype(std::data(std::declval<const Container&>())),
+        decltype(std::size(std::declval<const Container&>()))>
+    > : std::bool_constant<
+        std::is_same_v<decltype(std::data(std::declval<const Container&>())),
+                       const typename Container::value_type*> &&
+        batch_numeric_v<typename Container::value_type>> {};
+
+    template<typename Container>
+    inline constexpr bool is_contiguous_numeric_v = is_contiguous_numeric<Container>::value;
+
+    /**
+     * @brief Whether a sink renders numbers with the default stream format
+     *
+     * The batched path reproduces operator<< with default flags (decimal
+     * integers, %g with precision 6); streams with other state fall back to
+     * per-element formatting.
+     */
+    inline bool sink_has_default_number_format(const std::ostringstream& oss) {
+        return (oss.flags() & ~std::ios_base::skipws) == std::ios_base::dec &&
+               oss.precision() == 6 && oss.width() == 0;
+    }
+
+    /**
+     * @brief String buffer sinks always use the default number format
+     */
+    inline bool sink_has_default_number_format(const std::string&) {
+        return true;
+    }
+
+    /**
+     * @brief Write numbers joined by a delimiter, batched through std::to_chars
+     *
+     * Renders into a stack buffer and writes to the sink once per chunk
+     * instead of going through the stream for every element.
+     *
+     * @return false (writing nothing) if the delimiter is too long to batch
+     */
+    template<typename Sink, typename T>
+    bool sink_write_numbers(Sink& out, const T* values, std::size_t count, std::string_view delimiter) {
+        constexpr std::size_t max_number = 64;
+        char buffer[1024];
+        if (delimiter.size() > sizeof(buffer) / 4) {
+            return false;
         }
-#else
-        if constexpr (has_size_v<Container>) {
-            return c.size();
-        } else {
-            // For containers without size() like forward_list, count elements
-            return std::distance(c.begin(), c.end());
+
+        std::size_t used = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (sizeof(buffer) - used < delimiter.size() + max_number) {
+                sink_write(out, std::string_view(buffer, used));
+                used = 0;
+            }
+            if (i > 0) {
+                std::memcpy(buffer + used, delimiter.data(), delimiter.size());
+                used += delimiter.size();
+            }
+            std::to_chars_result result;
+            if constexpr (std::is_floating_point_v<T>) {
+                // Same as operator<< with default flags: %g, precision 6
+                result = std::to_chars(buffer + used, buffer + sizeof(buffer), values[i],
+                                       std::chars_format::general, 6);
+            } else {
+                result = std::to_chars(buffer + used, buffer + sizeof(buffer), values[i]);
+            }
+            used = static_cast<std::size_t>(result.ptr - buffer);
         }
-#endif
+        sink_write(out, std::string_view(buffer, used));
+        return true;
     }
 
     /**
-     * @brief Append container formatted value to stream
+     * @brief Render a container formatted value into a sink
+     *
+     * Iteration stops after max_items elements; whether the output is
+     * truncated is decided by probing one element further, so containers
+     * without size() (e.g. forward_list) are never walked to the end.
      */
+    template<typename Sink, typename Format>
+    void render_container(Sink& out, const Format& fmt) {
+        using T = typename Format::value_type;
+        const auto& container = fmt.value;
+        const auto end = container.end();
+
+        // Position at start_index, or report an empty range if it is out of bounds
+        auto it = container.begin();
 #if FAILSAFE_HAS_CONCEPTS
-    template<typename T>
-    void append_to_stream(std::ostringstream& oss, const container_format<T>& fmt) {
+        if constexpr (has_size<T>) {
 #else
-    template<typename T, typename Enable>
-    void append_to_stream(std::ostringstream& oss, const container_format<T, Enable>& fmt) {
+        if constexpr (has_size_v<T>) {
 #endif
-        const auto& container = fmt.value;
-        auto size = get_container_size(container);
-
-        // Calculate actual range to display
-        auto start_it = container.begin();
-        if (fmt.start_index < size) {
-            std::advance(start_it, fmt.start_index);
+            if (fmt.start_index >= static_cast<std::size_t>(container.size())) {
+                it = end;
+            } else {
+                std::advance(it, fmt.start_index);
+            }
         } else {
+            for (std::size_t skipped = 0; skipped < fmt.start_index && it != end; ++skipped) {
+                ++it;
+            }
+        }
+        if (it == end) {
             // Start index beyond container size
-            oss << fmt.prefix << fmt.suffix;
+            sink_write(out, fmt.prefix);
+            sink_write(out, fmt.suffix);
             return;
         }
 
-        auto items_to_show = std::min(fmt.max_items, size - fmt.start_index);
-        bool truncated = (fmt.start_index + items_to_show) < size;
+        sink_write(out, fmt.prefix);
 
-        oss << fmt.prefix;
+        const bool any_shown = fmt.max_items > 0;
+        if (fmt.multiline && any_shown) {
+            sink_write(out, "\n");
+        }
 
-        if (fmt.multiline && items_to_show > 0) {
-            oss << "\n";
+        bool batched = false;
+        if constexpr (is_contiguous_numeric_v<T>) {
+            if (!fmt.multiline && !fmt.show_indices && sink_has_default_number_format(out)) {
+                const std::size_t available = static_cast<std::size_t>(std::size(container)) - fmt.start_index;
+                const std::size_t shown = std::min(fmt.max_items, available);
+                batched = sink_write_numbers(out, std::data(container) + fmt.start_index, shown, fmt.delimiter);
+                if (batched) {
+                    std::advance(it, shown);
+                }
+            }
         }
 
-        std::size_t index = fmt.start_index;
-        auto it = start_it;
+        if (!batched) {
+            std::size_t index = fmt.start_index;
+            for (std::size_t i = 0; i < fmt.max_items && it != end; ++i, ++it, ++index) {
+                if (i > 0) {
+                    sink_write(out, fmt.delimiter);
+                    if (fmt.multiline) {
+                        sink_write(out, "\n");
+                    }
+                }
 
-        for (std::size_t i = 0; i < items_to_show && it != container.end(); ++i, ++it, ++index) {
-            if (i > 0) {
-                oss << fmt.delimiter;
                 if (fmt.multiline) {
-                    oss << "\n";
+                    sink_write(out, fmt.indent);
                 }
-            }
 
-            if (fmt.multiline) {
-                oss << fmt.indent;
-            }
-
-            if (fmt.show_indices) {
-                oss << "[" << index << "]: ";
-            }
+                if (fmt.show_indices) {
+                    sink_write(out, "[");
+                    sink_append(out, index);
+                    sink_write(out, "]: ");
+                }
 
-            // Handle map-like containers specially
+                // Handle map-like containers specially
 #if FAILSAFE_HAS_CONCEPTS
-            if constexpr (map_like<T>) {
+                if constexpr (map_like<T>) {
 #else
-            if constexpr (map_like_v<T>) {
+                if constexpr (map_like_v<T>) {
 #endif
-                append_to_stream(oss, it->first);
-                oss << ": ";
-                append_to_stream(oss, it->second);
-            } else {
-                append_to_stream(oss, *it);
+                    sink_append(out, it->first);
+                    sink_write(out, ": ");
+                    sink_append(out, it->second);
+                } else {
+                    sink_append(out, *it);
+                }
             }
         }
 
+        // Elements left after max_items: the output is truncated
+        const bool truncated = it != end;
         if (truncated) {
-            if (items_to_show > 0) {
-                oss << fmt.delimiter;
+            if (any_shown) {
+                sink_write(out, fmt.delimiter);
                 if (fmt.multiline) {
-                    oss << "\n" << fmt.indent;
+                    sink_write(out, "\n");
+                    sink_write(out, fmt.indent);
                 }
             }
-            oss << fmt.ellipsis;
+            sink_write(out, fmt.ellipsis);
         }
 
-        if (fmt.multiline && (items_to_show > 0 || truncated)) {
-            oss << "\n";
+        if (fmt.multiline && (any_shown || truncated)) {
+            sink_write(out, "\n");
         }
 
-        oss << fmt.suffix;
+        sink_write(out, fmt.suffix);
+    }
+
+    /**
+     * @brief Append container formatted value to stream
+     */
+#if FAILSAFE_HAS_CONCEPTS
+    template<typename T>
+    void append_to_stream(std::ostringstream& oss, const container_format<T>& fmt) {
+#else
+    template<typename T, typename Enable>
+    void append_to_stream(std::ostringstream& oss, const container_format<T, Enable>& fmt) {
+#endif
+        render_container(oss, fmt);
     }
 
     // Add overloads for non-const lvalue and rvalue references
@@ -984,20 +1306,116 @@ namespace failsafe::detail {
     }
 #endif
 
+    /**
+     * @brief Render a hex dump into a sink
+     *
+     * Lines are assembled in a stack buffer and flushed in chunks, so large
+     * dumps stream into the sink without intermediate strings.
+     */
+    template<typename Sink>
+    void render_hexdump(Sink& out, const hexdump_format& fmt) {
+        const hexdump_options& opts = fmt.options;
+        const std::size_t width = std::clamp<std::size_t>(opts.width, 1, 64);
+        const std::size_t shown = opts.max_bytes > 0 ? std::min(fmt.size, opts.max_bytes) : fmt.size;
+
+        // Offsets use 8 digits unless the last one needs more
+        const std::size_t last_offset = opts.base_offset + (shown > 0 ? shown - 1 : 0);
+        const std::size_t offset_digits = last_offset > 0xFFFFFFFFULL ? 16 : 8;
+
+        // offset + 2, "xx " per byte, a gap every 8 bytes, 2 + "|ascii|", newline
+        constexpr std::size_t max_line = 16 + 2 + 3 * 64 + 8 + 2 + 66 + 1;
+        char buffer[4 * max_line];
+        std::size_t used = 0;
+        char hex_pairs[2 * 64];
+
+        for (std::size_t line = 0; line < shown; line += width) {
+            if (sizeof(buffer) - used < max_line) {
+                sink_write(out, std::string_view(buffer, used));
+                used = 0;
+            }
+            if (line > 0) {
+                buffer[used++] = '\n';
+            }
+
+            char digits[16];
+            const std::size_t offset = opts.base_offset + line;
+            const std::size_t count = format_hex_digits(digits, offset, opts.uppercase);
+            const std::size_t pad = count < offset_digits ? offset_digits - count : 0;
+            std::memset(buffer + used, '0', pad);
+            std::memcpy(buffer + used + pad, digits, count);
+            used += pad + count;
+            buffer[used++] = ' ';
+
+            const std::size_t n = std::min(width, shown - line);
+            const unsigned char* bytes = fmt.data + line;
+            format_hex_bytes(hex_pairs, bytes, n, opts.uppercase);
+            // Short last lines are padded only to keep the ASCII column aligned
+            const std::size_t columns = opts.show_ascii ? width : n;
+            for (std::size_t i = 0; i < columns; ++i) {
+                buffer[used++] = ' ';
+                if (i > 0 && i % 8 == 0) {
+                    buffer[used++] = ' ';
+                }
+                if (i < n) {
+                    std::memcpy(buffer + used, hex_pairs + 2 * i, 2);
+                } else {
+                    std::memcpy(buffer + used, "  ", 2);
+                }
+                used += 2;
+            }
+
+            if (opts.show_ascii) {
+                std::memcpy(buffer + used, "  |", 3);
+                used += 3;
+                format_printable_ascii(buffer + used, bytes, n);
+                used += n;
+                buffer[used++] = '|';
+            }
+        }
+
+        if (shown < fmt.size) {
+            if (sizeof(buffer) - used < max_line) {
+                sink_write(out, std::string_view(buffer, used));
+                used = 0;
+            }
+            if (shown > 0) {
+                buffer[used++] = '\n';
+            }
+            std::memcpy(buffer + used, "... ", 4);
+            used += 4;
+            sink_write(out, std::string_view(buffer, used));
+            sink_append(out, fmt.size - shown);
+            sink_write(out, " more bytes");
+            return;
+        }
+
+        sink_write(out, std::string_view(buffer, used));
+    }
+
+    /**
+     * @brief Append hex dump to stream
+     */
+    inline void append_to_stream(std::ostringstream& oss, const hexdump_format& fmt) {
+        render_hexdump(oss, fmt);
+    }
+
+    inline void append_to_stream(std::ostringstream& oss, hexdump_format& fmt) {
+        render_hexdump(oss, fmt);
+    }
+
+    inline void append_to_stream(std::ostringstream& oss, hexdump_format&& fmt) {
+        render_hexdump(oss, fmt);
+    }
+
     /**
      * @brief Append uppercase formatted value to stream
      */
     template<typename T>
     void append_to_stream(std::ostringstream& oss, const uppercase_format <T>& fmt) {
-        // First, get the string representation
-        std::ostringstream temp;
-        append_to_stream(temp, fmt.value);
-        std::string str = temp.str();
-
-        // Convert to uppercase
-        std::transform(str.begin(), str.end(), str.begin(),
-                       [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
-        oss << str;
+        // Render the value, then convert it where it landed in the stream
+        const std::size_t start = sink_position(oss);
+        append_to_stream(oss, fmt.value);
+        sink_transform_case<letter_case::upper>(oss, start);
     }
 
     /**
@@ -1005,15 +1423,67 @@ namespace failsafe::detail {
      */
     template<typename T>
     void append_to_stream(std::ostringstream& oss, const lowercase_format <T>& fmt) {
-        // First, get the string representation
-        std::ostringstream temp;
-        append_to_stream(temp, fmt.value);
-        std::string str = temp.str();
+        // Render the value, then convert it where it landed in the stream
+        const std::size_t start = sink_position(oss);
+        append_to_stream(oss, fmt.value);
+        sink_transform_case<letter_case::lower>(oss, start);
+    }
 
-        // Convert to lowercase
-        std::transform(str.begin(), str.end(), str.begin(),
-                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
-        oss << str;
+    /**
+     * @brief Render a container with the default layout into a sink
+     *
+     * Maps and sets use braces, sequences use brackets.
+     */
+    template<typename Sink, typename Container>
+    void render_default_container(Sink& out, const Container& value) {
+#if FAILSAFE_HAS_CONCEPTS
+        if constexpr (map_like<Container>) {
+#else
+        if constexpr (map_like_v<Container>) {
+#endif
+            // Maps use braces by default
+            sink_write(out, "{");
+            bool first = true;
+            for (const auto& [key, val] : value) {
+                if (!first) sink_write(out, ", ");
+                first = false;
+                sink_append(out, key);
+                sink_write(out, ": ");
+                sink_append(out, val);
+            }
+            sink_write(out, "}");
+#if FAILSAFE_HAS_CONCEPTS
+        } else if constexpr (set_like<Container>) {
+#else
+        } else if constexpr (set_like_v<Container>) {
+#endif
+            // Sets use braces by default
+            sink_write(out, "{");
+            bool first = true;
+            for (const auto& item : value) {
+                if (!first) sink_write(out, ", ");
+                first = false;
+                sink_append(out, item);
+            }
+            sink_write(out, "}");
+        } else {
+            // Sequences use brackets by default
+            sink_write(out, "[");
+            if constexpr (is_contiguous_numeric_v<Container>) {
+                if (sink_has_default_number_format(out) &&
+                    sink_write_numbers(out, std::data(value), static_cast<std::size_t>(std::size(value)), ", ")) {
+                    sink_write(out, "]");
+                    return;
+                }
+            }
+            bool first = true;
+            for (const auto& item : value) {
+                if (!first) sink_write(out, ", ");
+                first = false;
+                sink_append(out, item);
+            }
+            sink_write(out, "]");
+        }
     }
 
     /**
@@ -1081,18 +1551,8 @@ namespace failsafe::detail {
 #endif
             // Convert to system_clock time_point if possible
             if constexpr (std::is_convertible_v <DecayT, std::chrono::system_clock::time_point>) {
-                auto tp = std::chrono::system_clock::time_point(value);
-                auto time_t = std::chrono::system_clock::to_time_t(tp);
-
-                // Get milliseconds part
-                auto ms = std::chrono::duration_cast <std::chrono::milliseconds>(
-                              tp.time_since_epoch()) % 1000;
-
                 // Format as ISO 8601
-                std::tm tm{};
-                safe_gmtime(&time_t, &tm);
-                oss << std::put_time(&tm, "%Y-%m-%dT%H:%M:%S");
-                oss << '.' << std::setfill('0') << std::setw(3) << ms.count() << 'Z';
+                sink_write_timestamp(oss, std::chrono::system_clock::time_point(value));
             } else {
                 // For other clocks, just output the duration since epoch
                 auto duration = value.time_since_epoch();
@@ -1127,18 +1587,9 @@ namespace failsafe::detail {
                 }
             }, value);
         }
-        // Handle std::wstring before containers to avoid treating it as a container
-        else if constexpr (std::is_same_v<DecayT, std::wstring>) {
-            std::string utf8_string;
-            // Check the size of wchar_t to determine encoding
-            if constexpr (sizeof(wchar_t) == 2) {
-                // Windows: UTF-16
-                utf8::utf16to8(value.begin(), value.end(), std::back_inserter(utf8_string));
-            } else if constexpr (sizeof(wchar_t) == 4) {
-                // Linux/Unix: UTF-32
-                utf8::utf32to8(value.begin(), value.end(), std::back_inserter(utf8_string));
-            }
-            oss << utf8_string;
+        // Handle wide strings before containers to avoid treating them as containers
+        else if constexpr (std::is_same_v<DecayT, std::wstring> || std::is_same_v<DecayT, std::wstring_view>) {
+            sink_write_utf8(oss, value.data(), value.size());
         }
         // Handle containers (vector, list, set, map, etc.) - must come before tuple check
         // because std::array has tuple_size but should be treated as a container
@@ -1146,51 +1597,12 @@ namespace failsafe::detail {
         else if constexpr (container_like<DecayT> ||
                            (has_begin_end<DecayT> && requires { typename DecayT::value_type; } &&
                             !is_string_like<DecayT>)) {
-            // Default formatting for containers
-            if constexpr (map_like<DecayT>) {
 #else
         else if constexpr (container_like_v<DecayT> ||
                            (has_begin_end_v<DecayT> && has_value_type<DecayT>::value &&
                             !is_string_like_v<DecayT>)) {
-            // Default formatting for containers
-            if constexpr (map_like_v<DecayT>) {
-#endif
-                // Maps use braces by default
-                oss << "{";
-                bool first = true;
-                for (const auto& [key, val] : value) {
-                    if (!first) oss << ", ";
-                    first = false;
-                    append_to_stream(oss, key);
-                    oss << ": ";
-                    append_to_stream(oss, val);
-                }
-                oss << "}";
-#if FAILSAFE_HAS_CONCEPTS
-            } else if constexpr (set_like<DecayT>) {
-#else
-            } else if constexpr (set_like_v<DecayT>) {
 #endif
-                // Sets use braces by default
-                oss << "{";
-                bool first = true;
-                for (const auto& item : value) {
-                    if (!first) oss << ", ";
-                    first = false;
-                    append_to_stream(oss, item);
-                }
-                oss << "}";
-            } else {
-                // Sequences use brackets by default
-                oss << "[";
-                bool first = true;
-                for (const auto& item : value) {
-                    if (!first) oss << ", ";
-                    first = false;
-                    append_to_stream(oss, item);
-                }
-                oss << "]";
-            }
+            render_default_container(oss, value);
         }
         // Handle std::pair
 #if FAILSAFE_HAS_CONCEPTS
@@ -1231,21 +1643,7 @@ namespace failsafe::detail {
      * @brief Specialization for std::wstring to handle UTF-16/UTF-32 to UTF-8 conversion
      */
     inline void append_to_stream(std::ostringstream& oss, const std::wstring& value) {
-        std::string utf8_string;
-        
-        // Check the size of wchar_t to determine encoding
-        if constexpr (sizeof(wchar_t) == 2) {
-            // Windows: UTF-16
-            utf8::utf16to8(value.begin(), value.end(), std::back_inserter(utf8_string));
-        } else if constexpr (sizeof(wchar_t) == 4) {
-            // Linux/Unix: UTF-32
-            // Convert to u32string first to avoid sign-conversion warning
-            // (wchar_t is signed on Linux, but char32_t is unsigned)
-            std::u32string u32_temp(value.begin(), value.end());
-            utf8::utf32to8(u32_temp.begin(), u32_temp.end(), std::back_inserter(utf8_string));
-        }
-        
-        oss << utf8_string;
+        sink_write_utf8(oss, value.data(), value.size());
     }
 
     /**
@@ -1267,7 +1665,7 @@ namespace failsafe::detail {
      */
     inline void append_to_stream(std::ostringstream& oss, const wchar_t* value) {
         if (value) {
-            append_to_stream(oss, std::wstring(value));
+            sink_write_utf8(oss, value, std::char_traits<wchar_t>::length(value));
         } else {
             oss << "nullptr";
         }
@@ -1284,7 +1682,7 @@ namespace failsafe::detail {
      * @brief Specialization for std::wstring_view
      */
     inline void append_to_stream(std::ostringstream& oss, const std::wstring_view& value) {
-        append_to_stream(oss, std::wstring(value));
+        sink_write_utf8(oss, value.data(), value.size());
     }
 
     /**
@@ -1301,11 +1699,27 @@ namespace failsafe::detail {
         append_to_stream(oss, static_cast<const std::wstring_view&>(value));
     }
 
+} // namespace failsafe::detail
+
+// Format engine implementation; needs all append_to_stream overloads above
+#if FAILSAFE_FORMAT_ENGINE != FAILSAFE_FORMAT_ENGINE_IOSTREAM
+#include <failsafe/detail/format_engine.hh>
+#endif
+
+// Type-erased arguments; needs all append_to_stream/append_to_buffer overloads above
+#include <failsafe/detail/format_args.hh>
+
+namespace failsafe::detail {
+
     /**
      * @brief Build a message string from variadic arguments
      *
      * Concatenates all arguments into a single string, separated by spaces.
-     * Uses append_to_stream for special formatting of various types.
+     * Uses append_to_stream for special formatting of various types, or the
+     * selected format engine when FAILSAFE_FORMAT_ENGINE is not iostream.
+     *
+     * Only erases the argument types (see format_args.hh); the message is
+     * built by the non-template build_message_from_args().
      *
      * @tparam Args Variadic template parameter pack
      * @param args Arguments to concatenate
@@ -1316,14 +1730,8 @@ namespace failsafe::detail {
         if constexpr (sizeof...(args) == 0) {
             return "";
         } else {
-            std::ostringstream oss;
-            ((append_to_stream(oss, std::forward <Args>(args)), oss << " "), ...);
-            std::string output = oss.str();
-            // Remove trailing space
-            if (!output.empty() && output.back() == ' ') {
-                output.pop_back();
-            }
-            return output;
+            const format_arg erased[] = {make_format_arg(std::forward <Args>(args))...};
+            return build_message_from_args(format_args{erased, sizeof...(Args)});
         }
     }
 
@@ -0,0 +1,181 @@
+/**
+ * @file throw_counters-inl.hh
+ * @brief Definitions of the throw counter functions
+ *
+ * @note Included by throw_counters.hh in header-only mode and compiled into
+ *       failsafe_impl otherwise, see export.hh.
+ */
+#pragma once
+
+#include <failsafe/detail/throw_counters.hh>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <mutex>
+
+namespace failsafe::detail {
+
+    namespace throw_counters_internal {
+        constexpr std::size_t shard_count = 16;
+        constexpr std::size_t overflow_slot = max_throw_sites;
+
+        static_assert((max_throw_sites & (max_throw_sites - 1)) == 0, "max_throw_sites must be a power of two");
+
+        /**
+         * @brief A registered site; `key` is published last, with release
+         *        ordering, so readers that see it also see the other fields
+         */
+        struct site {
+            std::atomic <std::uint64_t> key{0};
+            const char* file = nullptr;
+            int line = 0;
+            const char* expression = nullptr;
+        };
+
+        /** @brief The counters of one group of threads, on their own cache lines */
+        struct alignas(64) shard {
+            std::atomic <std::uint64_t> counts[max_throw_sites + 1] = {};
+        };
+
+        FAILSAFE_INLINE std::int64_t now_ns() noexcept {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        struct registry {
+            site sites[max_throw_sites];
+            std::mutex insert_mutex;
+            shard shards[shard_count];
+            std::atomic <std::int64_t> start_ns{now_ns()};
+            std::atomic <std::size_t> next_shard{0};
+        };
+
+        FAILSAFE_INLINE registry& counters() {
+            static registry instance;
+            return instance;
+        }
+
+        FAILSAFE_INLINE const char* or_empty(const char* text) noexcept {
+            return text != nullptr ? text : "";
+        }
+
+        /**
+         * @brief 64-bit FNV-1a of the site identity; never zero
+         */
+        FAILSAFE_INLINE std::uint64_t site_key(const char* file, int line, const char* expression) noexcept {
+            std::uint64_t hash = 14695981039346656037ull;
+            auto mix = [&hash](unsigned char byte) {
+                hash = (hash ^ byte) * 1099511628211ull;
+            };
+            for (const char* c = file; *c != '\0'; ++c) {
+                mix(static_cast<unsigned char>(*c));
+            }
+            auto value = static_cast<std::uint32_t>(line);
+            for (int i = 0; i < 4; ++i) {
+                mix(static_cast<unsigned char>(value & 0xffu));
+                value >>= 8;
+            }
+            for (const char* c = expression; *c != '\0'; ++c) {
+                mix(static_cast<unsigned char>(*c));
+            }
+            return hash | 1u;
+        }
+
+        FAILSAFE_INLINE bool same_site(const site& s, const char* file, int line, const char* expression) noexcept {
+            return s.line == line && std::strcmp(s.file, file) == 0 && std::strcmp(s.expression, expression) == 0;
+        }
+
+        /**
+         * @brief Slot of a site, registered on first use; overflow_slot if
+         *        the table is full
+         *
+         * Lookups only read; registration takes the lock and probes again.
+         */
+        FAILSAFE_INLINE std::size_t find_site(registry& r, const char* file, int line, const char* expression) {
+            constexpr std::size_t mask = max_throw_sites - 1;
+            const std::uint64_t key = site_key(file, line, expression);
+
+            for (std::size_t probe = 0, i = key & mask; probe < max_throw_sites; ++probe, i = (i + 1) & mask) {
+                const std::uint64_t found = r.sites[i].key.load(std::memory_order_acquire);
+                if (found == 0) {
+                    break;
+                }
+                if (found == key && same_site(r.sites[i], file, line, expression)) {
+                    return i;
+                }
+            }
+
+            std::lock_guard <std::mutex> lock(r.insert_mutex);
+            for (std::size_t probe = 0, i = key & mask; probe < max_throw_sites; ++probe, i = (i + 1) & mask) {
+                site& s = r.sites[i];
+                const std::uint64_t found = s.key.load(std::memory_order_relaxed);
+                if (found == 0) {
+                    s.file = file;
+                    s.line = line;
+                    s.expression = expression;
+                    s.key.store(key, std::memory_order_release);
+                    return i;
+                }
+                if (found == key && same_site(s, file, line, expression)) {
+                    return i;
+                }
+            }
+            return overflow_slot;
+        }
+    } // namespace throw_counters_internal
+
+    FAILSAFE_INLINE const char*& current_throw_expression() noexcept {
+        static thread_local const char* expression = nullptr;
+        return expression;
+    }
+
+    FAILSAFE_INLINE void count_throw(const char* file, int line) noexcept {
+        using namespace throw_counters_internal;
+        registry& r = counters();
+        static thread_local const std::size_t shard_index =
+            r.next_shard.fetch_add(1, std::memory_order_relaxed) % shard_count;
+
+        const std::size_t slot = find_site(r, file, line, or_empty(current_throw_expression()));
+        r.shards[shard_index].counts[slot].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    FAILSAFE_INLINE std::vector <throw_site_record> throw_counts(double& elapsed_seconds) {
+        using namespace throw_counters_internal;
+        registry& r = counters();
+        elapsed_seconds = static_cast<double>(now_ns() - r.start_ns.load(std::memory_order_relaxed)) / 1e9;
+
+        std::vector <throw_site_record> records;
+        for (std::size_t slot = 0; slot <= max_throw_sites; ++slot) {
+            std::uint64_t count = 0;
+            for (const shard& s : r.shards) {
+                count += s.counts[slot].load(std::memory_order_relaxed);
+            }
+            if (count == 0) {
+                continue;
+            }
+            if (slot == overflow_slot) {
+                records.push_back({slot, nullptr, 0, "", count});
+            } else {
+                const site& s = r.sites[slot];
+                if (s.key.load(std::memory_order_acquire) == 0) {
+                    continue;
+                }
+                records.push_back({slot, s.file, s.line, s.expression, count});
+            }
+        }
+        return records;
+    }
+
+    FAILSAFE_INLINE void reset_throw_counts() noexcept {
+        using namespace throw_counters_internal;
+        registry& r = counters();
+        for (shard& s : r.shards) {
+            for (auto& count : s.counts) {
+                count.store(0, std::memory_order_relaxed);
+            }
+        }
+        r.start_ns.store(now_ns(), std::memory_order_relaxed);
+    }
+
+} // namespace failsafe::detail
@@ -0,0 +1,104 @@
+/**
+ * @file throw_counters.hh
+ * @brief Per call site counts of raised exceptions
+ *
+ * @details
+ * Every exception raised by THROW, ENFORCE (through its built-in raisers),
+ * failsafe::result::value() and failsafe::status::throw_if_error() is
+ * counted under its call site: file, line and, for enforcements, the
+ * checked expression. The counting happens on the throw path only, which
+ * already allocates and unwinds, and costs one hash and one relaxed atomic
+ * increment.
+ *
+ * Sites are registered once in a fixed table of max_throw_sites entries;
+ * later sites are counted together under an overflow record. Threads are
+ * spread round-robin over 16 cache-line-aligned shards of the counters, so
+ * up to 16 threads raising from the same site do not share a cache line. A
+ * snapshot sums the shards.
+ *
+ * Reported by the functions of throw_stats.hh.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <failsafe/detail/export.hh>
+
+namespace failsafe::detail {
+
+    /** @brief Call sites counted individually */
+    constexpr std::size_t max_throw_sites = 512;
+
+    /**
+     * @brief Count of one call site
+     *
+     * The overflow record, counting the sites beyond max_throw_sites, has
+     * a null file.
+     */
+    struct throw_site_record {
+        std::size_t slot; ///< Stable index of the site in the table
+        const char* file; ///< Source file of the call site
+        int line; ///< Source line of the call site
+        const char* expression; ///< Checked expression; empty for THROW
+        std::uint64_t count; ///< Exceptions raised since the last reset
+    };
+
+    /**
+     * @brief Count an exception raised from a call site
+     *
+     * Called by throw_exception_from_args(). The expression is the one of
+     * the innermost live throw_expression_scope of the thread, if any.
+     *
+     * @param file Source file (must have static storage duration)
+     * @param line Source line
+     */
+    FAILSAFE_API void count_throw(const char* file, int line) noexcept;
+
+    /**
+     * @brief The counted sites, with non-zero counts, in table order
+     *
+     * @param[out] elapsed_seconds Time since the counts started (first
+     *             use or last reset)
+     */
+    FAILSAFE_API std::vector <throw_site_record> throw_counts(double& elapsed_seconds);
+
+    /** @brief Zero all counts; sites stay registered */
+    FAILSAFE_API void reset_throw_counts() noexcept;
+
+    /**
+     * @brief Expression slot of the calling thread, read by count_throw()
+     * @internal
+     */
+    FAILSAFE_API const char*& current_throw_expression() noexcept;
+
+    /**
+     * @brief Attributes exceptions raised in its lifetime to an expression
+     *
+     * Set by the enforcer around its raiser call, so that ENFORCE failures
+     * are counted with their checked expression.
+     */
+    class throw_expression_scope {
+        public:
+            explicit throw_expression_scope(const char* expression) noexcept
+                : previous_(std::exchange(current_throw_expression(), expression)) {
+            }
+
+            ~throw_expression_scope() {
+                current_throw_expression() = previous_;
+            }
+
+            throw_expression_scope(const throw_expression_scope&) = delete;
+            throw_expression_scope& operator=(const throw_expression_scope&) = delete;
+
+        private:
+            const char* previous_;
+    };
+
+} // namespace failsafe::detail
+
+#ifdef FAILSAFE_HEADER_ONLY
+#include <failsafe/detail/throw_counters-inl.hh>
+#endif
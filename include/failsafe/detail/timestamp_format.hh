@@ -0,0 +1,277 @@
+/**
+ * @file timestamp_format.hh
+ * @brief ISO-8601 rendering of system_clock time points
+ *
+ * @details
+ * Renders "YYYY-MM-DDTHH:MM:SS" followed by a configurable fraction of a
+ * second into a caller-provided buffer. The date and time part is cached
+ * per thread for the most recently rendered second, so consecutive
+ * timestamps within the same second only format the fraction:
+ * - UTC prefixes are computed arithmetically, without calling gmtime
+ * - local time prefixes call localtime once per second and thread
+ *
+ * Used by build_message() for std::chrono::system_clock::time_point
+ * arguments and by the CerrBackend timestamp column.
+ *
+ * Configuration options:
+ * - FAILSAFE_TIMESTAMP_PRECISION: Fractional digits (0, 3, 6 or 9)
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+
+/**
+ * @defgroup TimestampConfig Timestamp Format Configuration
+ * @{
+ */
+
+/**
+ * @brief Number of fractional second digits in rendered timestamps
+ *
+ * - 0: whole seconds
+ * - 3: milliseconds (default)
+ * - 6: microseconds
+ * - 9: nanoseconds
+ */
+#ifndef FAILSAFE_TIMESTAMP_PRECISION
+#define FAILSAFE_TIMESTAMP_PRECISION 3
+#endif
+
+/** @} */ // end of TimestampConfig group
+
+static_assert(FAILSAFE_TIMESTAMP_PRECISION == 0 || FAILSAFE_TIMESTAMP_PRECISION == 3 ||
+              FAILSAFE_TIMESTAMP_PRECISION == 6 || FAILSAFE_TIMESTAMP_PRECISION == 9,
+              "FAILSAFE_TIMESTAMP_PRECISION must be 0, 3, 6 or 9");
+
+namespace failsafe::detail {
+
+    /**
+     * @brief Thread-safe wrapper for gmtime
+     * @param time Pointer to time_t value
+     * @param result Pointer to tm struct to store result
+     * @return Pointer to result on success, nullptr on failure
+     */
+    inline std::tm* safe_gmtime(const std::time_t* time, std::tm* result) {
+#ifdef _WIN32
+        return gmtime_s(result, time) == 0 ? result : nullptr;
+#else
+        return gmtime_r(time, result);
+#endif
+    }
+
+    /**
+     * @brief Thread-safe wrapper for localtime
+     * @param time Pointer to time_t value
+     * @param result Pointer to tm struct to store result
+     * @return Pointer to result on success, nullptr on failure
+     */
+    inline std::tm* safe_localtime(const std::time_t* time, std::tm* result) {
+#ifdef _WIN32
+        return localtime_s(result, time) == 0 ? result : nullptr;
+#else
+        return localtime_r(time, result);
+#endif
+    }
+
+    /**
+     * @brief Time zone a timestamp is rendered in
+     */
+    enum class timestamp_zone {
+        utc, ///< Coordinated Universal Time
+        local ///< Local time of the process
+    };
+
+    /**
+     * @brief Buffer size sufficient for any format_timestamp() output
+     */
+    inline constexpr std::size_t timestamp_max_length = 40;
+
+    /**
+     * @internal
+     * @brief Broken down date and time of a second
+     */
+    struct civil_time {
+        std::int64_t year;
+        int month; ///< 1-12
+        int day; ///< 1-31
+        int hour;
+        int minute;
+        int second;
+    };
+
+    /**
+     * @internal
+     * @brief Convert seconds since the Unix epoch to a UTC date and time
+     *
+     * Proleptic Gregorian calendar, valid for the whole range of int64 days
+     * (H. Hinnant's civil_from_days algorithm).
+     */
+    inline civil_time civil_from_seconds(std::int64_t seconds) noexcept {
+        std::int64_t days = seconds / 86400;
+        std::int64_t rem = seconds % 86400;
+        if (rem < 0) {
+            rem += 86400;
+            --days;
+        }
+        days += 719468;
+        const std::int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+        const std::int64_t doe = days - era * 146097;
+        const std::int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        const std::int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        const std::int64_t mp = (5 * doy + 2) / 153;
+        const std::int64_t month = mp < 10 ? mp + 3 : mp - 9;
+
+        civil_time result{};
+        result.year = yoe + era * 400 + (month <= 2 ? 1 : 0);
+        result.month = static_cast<int>(month);
+        result.day = static_cast<int>(doy - (153 * mp + 2) / 5 + 1);
+        result.hour = static_cast<int>(rem / 3600);
+        result.minute = static_cast<int>(rem / 60 % 60);
+        result.second = static_cast<int>(rem % 60);
+        return result;
+    }
+
+    /**
+     * @internal
+     * @brief Write a zero padded decimal number
+     * @return Pointer past the last written character
+     */
+    inline char* write_padded(char* out, std::uint64_t value, int width) noexcept {
+        char digits[20];
+        int count = 0;
+        do {
+            digits[count++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value != 0);
+        for (int i = count; i < width; ++i) {
+            *out++ = '0';
+        }
+        while (count > 0) {
+            *out++ = digits[--count];
+        }
+        return out;
+    }
+
+    /**
+     * @internal
+     * @brief Render "YYYY-MM-DDTHH:MM:SS" for a broken down time
+     * @return Number of characters written
+     */
+    inline std::size_t render_civil_time(char* out, const civil_time& t) noexcept {
+        char* p = out;
+        std::uint64_t year;
+        if (t.year < 0) {
+            *p++ = '-';
+            year = static_cast<std::uint64_t>(-(t.year + 1)) + 1;
+        } else {
+            year = static_cast<std::uint64_t>(t.year);
+        }
+        p = write_padded(p, year, 4);
+        *p++ = '-';
+        p = write_padded(p, static_cast<std::uint64_t>(t.month), 2);
+        *p++ = '-';
+        p = write_padded(p, static_cast<std::uint64_t>(t.day), 2);
+        *p++ = 'T';
+        p = write_padded(p, static_cast<std::uint64_t>(t.hour), 2);
+        *p++ = ':';
+        p = write_padded(p, static_cast<std::uint64_t>(t.minute), 2);
+        *p++ = ':';
+        p = write_padded(p, static_cast<std::uint64_t>(t.second), 2);
+        return static_cast<std::size_t>(p - out);
+    }
+
+    /**
+     * @internal
+     * @brief Per-thread cache of the last rendered second
+     */
+    struct timestamp_cache {
+        std::int64_t second = 0; ///< Seconds since the epoch of the cached prefix
+        std::size_t length = 0; ///< Length of prefix, 0 while empty
+        char prefix[32] = {}; ///< Rendered date and time, 'T' separated
+    };
+
+    /**
+     * @internal
+     * @brief Access the calling thread's cache for a time zone
+     */
+    inline timestamp_cache& timestamp_cache_for(timestamp_zone zone) {
+        thread_local timestamp_cache caches[2];
+        return caches[zone == timestamp_zone::utc ? 0 : 1];
+    }
+
+    /**
+     * @internal
+     * @brief Fill a cache entry for the given second
+     */
+    inline void refresh_timestamp_cache(timestamp_cache& cache, std::int64_t seconds, timestamp_zone zone) {
+        civil_time t = civil_from_seconds(seconds);
+        if (zone == timestamp_zone::local) {
+            const auto time = static_cast<std::time_t>(seconds);
+            std::tm tm{};
+            // Falls back to UTC if the local time cannot be determined
+            if (safe_localtime(&time, &tm) != nullptr) {
+                t.year = static_cast<std::int64_t>(tm.tm_year) + 1900;
+                t.month = tm.tm_mon + 1;
+                t.day = tm.tm_mday;
+                t.hour = tm.tm_hour;
+                t.minute = tm.tm_min;
+                t.second = tm.tm_sec;
+            }
+        }
+        cache.length = render_civil_time(cache.prefix, t);
+        cache.second = seconds;
+    }
+
+    /**
+     * @brief Render a time point as an ISO-8601 timestamp
+     *
+     * Writes "YYYY-MM-DD<separator>HH:MM:SS" followed by '.' and `precision`
+     * fractional digits (nothing when precision is 0). No zone designator is
+     * appended. The output is not null-terminated.
+     *
+     * @param out Destination, at least timestamp_max_length characters
+     * @param tp Time point to render
+     * @param zone Render as UTC or local time
+     * @param separator Character between date and time
+     * @param precision Fractional digits: 0, 3, 6 or 9
+     * @return Number of characters written
+     */
+    inline std::size_t format_timestamp(char* out, std::chrono::system_clock::time_point tp,
+                                        timestamp_zone zone = timestamp_zone::utc,
+                                        char separator = 'T',
+                                        int precision = FAILSAFE_TIMESTAMP_PRECISION) {
+        // Split without converting the whole time point to nanoseconds, which
+        // could overflow for clocks with coarser ticks
+        auto whole = std::chrono::time_point_cast<std::chrono::seconds>(tp);
+        if (whole > tp) {
+            whole -= std::chrono::seconds(1);
+        }
+        const auto seconds = static_cast<std::int64_t>(whole.time_since_epoch().count());
+        const auto nanos = static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(tp - whole).count());
+
+        timestamp_cache& cache = timestamp_cache_for(zone);
+        if (cache.length == 0 || cache.second != seconds) {
+            refresh_timestamp_cache(cache, seconds, zone);
+        }
+        std::memcpy(out, cache.prefix, cache.length);
+        char* p = out + cache.length;
+        // The separator precedes the fixed width "HH:MM:SS" tail
+        p[-9] = separator;
+
+        if (precision > 0) {
+            std::uint64_t fraction = nanos;
+            for (int i = precision; i < 9; ++i) {
+                fraction /= 10;
+            }
+            *p++ = '.';
+            p = write_padded(p, fraction, precision);
+        }
+        return static_cast<std::size_t>(p - out);
+    }
+
+} // namespace failsafe::detail
@@ -0,0 +1,172 @@
+/**
+ * @file utf8_transcode.hh
+ * @brief UTF-16 / UTF-32 to UTF-8 conversion into caller-provided buffers
+ *
+ * @details
+ * Used to print wide string arguments. Code units are read as UTF-16 when
+ * the character type is 16 bits wide (wchar_t on Windows) and as UTF-32
+ * when it is 32 bits wide (wchar_t elsewhere). Conversion is a single pass
+ * without allocations:
+ * - runs of ASCII are narrowed sixteen code units per step with SSE2
+ * - unpaired surrogates and values outside the Unicode code space are
+ *   replaced with U+FFFD REPLACEMENT CHARACTER
+ *
+ * Define FAILSAFE_NO_SIMD to force the portable code path.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <failsafe/detail/simd.hh>
+
+namespace failsafe::detail {
+
+    /**
+     * @brief Longest UTF-8 sequence produced for a single code point
+     */
+    inline constexpr std::size_t utf8_max_sequence = 4;
+
+    /**
+     * @brief Code point substituted for malformed input
+     */
+    inline constexpr std::uint32_t utf8_replacement_character = 0xFFFD;
+
+    /**
+     * @brief Progress of a transcode_to_utf8() call
+     */
+    struct utf8_transcode_result {
+        std::size_t consumed; ///< Input code units converted
+        std::size_t written; ///< UTF-8 bytes produced
+    };
+
+    /**
+     * @brief Encode a valid code point as UTF-8
+     *
+     * @param out Destination, at least utf8_max_sequence characters
+     * @param cp Code point (not a surrogate, at most U+10FFFF)
+     * @return Number of bytes written
+     */
+    inline std::size_t encode_utf8(char* out, std::uint32_t cp) noexcept {
+        if (cp < 0x80) {
+            out[0] = static_cast<char>(cp);
+            return 1;
+        }
+        if (cp < 0x800) {
+            out[0] = static_cast<char>(0xC0 | (cp >> 6));
+            out[1] = static_cast<char>(0x80 | (cp & 0x3F));
+            return 2;
+        }
+        if (cp < 0x10000) {
+            out[0] = static_cast<char>(0xE0 | (cp >> 12));
+            out[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            out[2] = static_cast<char>(0x80 | (cp & 0x3F));
+            return 3;
+        }
+        out[0] = static_cast<char>(0xF0 | (cp >> 18));
+        out[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        out[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        out[3] = static_cast<char>(0x80 | (cp & 0x3F));
+        return 4;
+    }
+
+#if FAILSAFE_HAS_SSE2
+    /**
+     * @internal
+     * @brief Narrow sixteen code units if they are all ASCII
+     *
+     * @return false (and nothing written) if any unit is above 0x7F
+     */
+    template<typename CharT>
+    bool narrow_ascii_block(const CharT* in, char* out) noexcept {
+        const auto* src = reinterpret_cast<const __m128i*>(in);
+        __m128i packed;
+        if constexpr (sizeof(CharT) == 2) {
+            const __m128i a = _mm_loadu_si128(src);
+            const __m128i b = _mm_loadu_si128(src + 1);
+            const __m128i high = _mm_and_si128(_mm_or_si128(a, b), _mm_set1_epi16(static_cast<short>(0xFF80)));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) != 0xFFFF) {
+                return false;
+            }
+            packed = _mm_packus_epi16(a, b);
+        } else {
+            const __m128i a = _mm_loadu_si128(src);
+            const __m128i b = _mm_loadu_si128(src + 1);
+            const __m128i c = _mm_loadu_si128(src + 2);
+            const __m128i d = _mm_loadu_si128(src + 3);
+            const __m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+            const __m128i high = _mm_and_si128(any, _mm_set1_epi32(static_cast<int>(0xFFFFFF80U)));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128())) != 0xFFFF) {
+                return false;
+            }
+            // Every lane is below 0x80, so the saturating packs are exact
+            packed = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), packed);
+        return true;
+    }
+#endif
+
+    /**
+     * @brief Convert UTF-16 or UTF-32 code units to UTF-8
+     *
+     * Stops when the input is exhausted or fewer than utf8_max_sequence
+     * bytes of output space remain; call again with the unconsumed input to
+     * continue. Surrogate pairs are never split between calls.
+     *
+     * @param in Input code units
+     * @param size Number of input code units
+     * @param out Destination buffer
+     * @param capacity Size of the destination (at least utf8_max_sequence)
+     * @return Input units consumed and bytes written
+     */
+    template<typename CharT>
+    utf8_transcode_result transcode_to_utf8(const CharT* in, std::size_t size, char* out, std::size_t capacity) noexcept {
+        static_assert(sizeof(CharT) == 2 || sizeof(CharT) == 4, "UTF-16 or UTF-32 code units expected");
+        using unit_type = std::conditional_t<sizeof(CharT) == 2, std::uint16_t, std::uint32_t>;
+
+        std::size_t i = 0;
+        std::size_t o = 0;
+        while (i < size) {
+#if FAILSAFE_HAS_SSE2
+            if (size - i >= 16 && capacity - o >= 16 && narrow_ascii_block(in + i, out + o)) {
+                i += 16;
+                o += 16;
+                continue;
+            }
+#endif
+            // Convert one block's worth of units before trying the fast path again
+            const std::size_t block_end = std::min(size, i + 16);
+            while (i < block_end) {
+                if (capacity - o < utf8_max_sequence) {
+                    return {i, o};
+                }
+                std::uint32_t cp = static_cast<unit_type>(in[i++]);
+                if (cp < 0x80) {
+                    out[o++] = static_cast<char>(cp);
+                    continue;
+                }
+                if constexpr (sizeof(CharT) == 2) {
+                    if (cp >= 0xD800 && cp <= 0xDFFF) {
+                        const std::uint32_t low = i < size ? static_cast<unit_type>(in[i]) : 0U;
+                        if (cp <= 0xDBFF && low >= 0xDC00 && low <= 0xDFFF) {
+                            cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                            ++i;
+                        } else {
+                            cp = utf8_replacement_character;
+                        }
+                    }
+                } else {
+                    if ((cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF) {
+                        cp = utf8_replacement_character;
+                    }
+                }
+                o += encode_utf8(out + o, cp);
+            }
+        }
+        return {i, o};
+    }
+
+} // namespace failsafe::detail
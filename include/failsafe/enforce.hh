@@ -36,14 +36,40 @@
  */
 #pragma once
 
+#include <cstddef>
+#include <exception>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 #include <sstream>
+#include <string>
 #include <functional>
 
 #include <failsafe/exception.hh>
+#include <failsafe/result.hh>
+#include <failsafe/detail/attributes.hh>
 #include <failsafe/detail/string_utils.hh>
 #include <failsafe/detail/location_format.hh>
+#include <failsafe/detail/throw_counters.hh>
+#include <failsafe/detail/enforce_macros.hh>
+
+namespace failsafe::detail {
+    /**
+     * @brief Helper function to check if an index is valid
+     * 
+     * For unsigned types, only checks upper bound.
+     * For signed types, checks both bounds.
+     */
+    template<typename IndexT, typename SizeT>
+    inline constexpr bool is_valid_index(IndexT index, SizeT size) noexcept {
+        if constexpr (std::is_unsigned_v<IndexT>) {
+            return index < size;
+        } else {
+            // `&` instead of `&&`: no branch, so loops over indices vectorize
+            return (index >= 0) & (static_cast<std::make_unsigned_t<IndexT>>(index) < size);
+        }
+    }
+} // namespace failsafe::detail
 
 /**
  * @namespace failsafe::enforce
@@ -71,7 +97,7 @@ namespace failsafe::enforce {
          */
         struct truth {
             template<typename T>
-            static bool check(const T& value) {
+            static constexpr bool check(const T& value) {
                 if constexpr (std::is_pointer_v<T>) {
                     return value != nullptr;
                 } else {
@@ -79,7 +105,7 @@ namespace failsafe::enforce {
                 }
             }
             
-            static const char* description() { return "Expression must be true"; }
+            static constexpr const char* description() { return "Expression must be true"; }
         };
         
         /**
@@ -91,11 +117,11 @@ namespace failsafe::enforce {
             Expected expected; ///< The expected value
             
             template<typename T>
-            bool check(const T& value) const {
+            constexpr bool check(const T& value) const {
                 return value == expected;
             }
             
-            const char* description() const { return "Values must be equal"; }
+            constexpr const char* description() const { return "Values must be equal"; }
         };
         
         /**
@@ -107,11 +133,11 @@ namespace failsafe::enforce {
             Expected expected; ///< The value that should not match
             
             template<typename T>
-            bool check(const T& value) const {
+            constexpr bool check(const T& value) const {
                 return value != expected;
             }
             
-            const char* description() const { return "Values must not be equal"; }
+            constexpr const char* description() const { return "Values must not be equal"; }
         };
         
         /**
@@ -123,11 +149,11 @@ namespace failsafe::enforce {
             Bound bound; ///< Upper bound (exclusive)
             
             template<typename T>
-            bool check(const T& value) const {
+            constexpr bool check(const T& value) const {
                 return value < bound;
             }
             
-            const char* description() const { return "Value must be less than bound"; }
+            constexpr const char* description() const { return "Value must be less than bound"; }
         };
         
         /**
@@ -139,11 +165,43 @@ namespace failsafe::enforce {
             Bound bound; ///< Lower bound (exclusive)
             
             template<typename T>
-            bool check(const T& value) const {
+            constexpr bool check(const T& value) const {
                 return value > bound;
             }
             
-            const char* description() const { return "Value must be greater than bound"; }
+            constexpr const char* description() const { return "Value must be greater than bound"; }
+        };
+        
+        /**
+         * @brief Less-than-or-equal predicate
+         * @tparam Bound Type of upper bound
+         */
+        template<typename Bound>
+        struct less_equal {
+            Bound bound; ///< Upper bound (inclusive)
+            
+            template<typename T>
+            constexpr bool check(const T& value) const {
+                return value <= bound;
+            }
+            
+            constexpr const char* description() const { return "Value must be less than or equal to bound"; }
+        };
+        
+        /**
+         * @brief Greater-than-or-equal predicate
+         * @tparam Bound Type of lower bound
+         */
+        template<typename Bound>
+        struct greater_equal {
+            Bound bound; ///< Lower bound (inclusive)
+            
+            template<typename T>
+            constexpr bool check(const T& value) const {
+                return value >= bound;
+            }
+            
+            constexpr const char* description() const { return "Value must be greater than or equal to bound"; }
         };
         
         /**
@@ -157,11 +215,43 @@ namespace failsafe::enforce {
             Upper upper; ///< Upper bound (inclusive)
             
             template<typename T>
-            bool check(const T& value) const {
-                return value >= lower && value <= upper;
+            constexpr bool check(const T& value) const {
+                // Both comparisons without a branch, see enforce_all()
+                return static_cast<bool>(value >= lower) & static_cast<bool>(value <= upper);
+            }
+            
+            constexpr const char* description() const { return "Value must be in range"; }
+        };
+        
+        /**
+         * @brief Not-a-number predicate for floating point values
+         *
+         * Uses `value == value`, which the compiler can vectorize; note
+         * that -ffast-math assumes there are no NaNs and removes the test.
+         */
+        struct not_nan {
+            template<typename T>
+            static constexpr bool check(const T& value) {
+                return value == value;
             }
             
-            const char* description() const { return "Value must be in range"; }
+            static constexpr const char* description() { return "Value must not be NaN"; }
+        };
+        
+        /**
+         * @brief Index predicate: index in [0, size)
+         * @tparam Size Type of the container size
+         */
+        template<typename Size>
+        struct valid_index {
+            Size size; ///< Number of elements (exclusive upper bound)
+            
+            template<typename T>
+            constexpr bool check(const T& index) const {
+                return ::failsafe::detail::is_valid_index(index, size);
+            }
+            
+            constexpr const char* description() const { return "Index must be in [0, size)"; }
         };
         
     } // namespace predicates
@@ -179,10 +269,7 @@ namespace failsafe::enforce {
          */
         struct default_raiser {
             template<typename... Args>
-            #if FAILSAFE_TRAP_MODE == 2
-            [[noreturn]]
-            #endif
-            static void raise(const char* file, int line, Args&&... args) {
+            [[noreturn]] FAILSAFE_ALWAYS_INLINE static void raise(const char* file, int line, Args&&... args) {
                 ::failsafe::exception::internal::throw_exception<FAILSAFE_DEFAULT_EXCEPTION>(
                     file, line, std::forward<Args>(args)...);
             }
@@ -195,10 +282,7 @@ namespace failsafe::enforce {
         template<typename Exception>
         struct exception_raiser {
             template<typename... Args>
-            #if FAILSAFE_TRAP_MODE == 2
-            [[noreturn]]
-            #endif
-            static void raise(const char* file, int line, Args&&... args) {
+            [[noreturn]] FAILSAFE_ALWAYS_INLINE static void raise(const char* file, int line, Args&&... args) {
                 ::failsafe::exception::internal::throw_exception<Exception>(
                     file, line, std::forward<Args>(args)...);
             }
@@ -209,23 +293,168 @@ namespace failsafe::enforce {
          */
         struct trap_raiser {
             template<typename... Args>
-            [[noreturn]] static void raise(const char* file, int line, Args&&... args) {
-                ::failsafe::exception::internal::print_exception_info(file, line,
-                    ::failsafe::detail::build_message(std::forward<Args>(args)...));
-                psnip_trap();
-                std::terminate();
+            [[noreturn]] FAILSAFE_ALWAYS_INLINE static void raise(const char* file, int line, Args&&... args) {
+                ::failsafe::exception::internal::trap_site{file, line}(std::forward<Args>(args)...);
             }
         };
         
     } // namespace raisers
+
+    /**
+     * @namespace failsafe::enforce::internal
+     * @brief Internal implementation details (not part of public API)
+     */
+    namespace internal {
+        /**
+         * @brief Raise the default message of a failed enforcement
+         *
+         * Out of line and cold, instantiated once per raiser. Takes the call
+         * site data by value so the enforcer does not have to be kept in
+         * memory for it.
+         * @internal
+         */
+        template<typename Raiser>
+        FAILSAFE_NOINLINE FAILSAFE_COLD
+        void raise_default_message(const char* file, int line, const char* expr, const char* description) {
+            failsafe::detail::throw_expression_scope counted_as(expr);
+            ::failsafe::exception::internal::raise_site_scope raised_for(FAILSAFE_RETURN_ADDRESS());
+            Raiser::raise(file, line, "Enforcement failed: ", expr, " - ", description);
+        }
+
+        /**
+         * @brief raise_default_message() for the enforcer destructor
+         *
+         * Raises unless an exception thrown after the enforcer was created
+         * is propagating through it: raising then would terminate the
+         * program, so the failure is printed instead. A failure detected
+         * inside a destructor run by unwinding is still raised.
+         *
+         * @param uncaught std::uncaught_exceptions() when the check failed
+         * @internal
+         */
+        template<typename Raiser>
+        FAILSAFE_NOINLINE FAILSAFE_COLD
+        void raise_default_message_on_exit(const char* file, int line, const char* expr, const char* description,
+                                           int uncaught) {
+            if (std::uncaught_exceptions() > uncaught) {
+                ::failsafe::exception::internal::print_exception_info(
+                    file, line, std::string("Enforcement failed: ") + expr + " - " + description +
+                    " (not raised: another exception is propagating)");
+                return;
+            }
+            failsafe::detail::throw_expression_scope counted_as(expr);
+            ::failsafe::exception::internal::raise_site_scope raised_for(FAILSAFE_RETURN_ADDRESS());
+            Raiser::raise(file, line, "Enforcement failed: ", expr, " - ", description);
+        }
+
+        /**
+         * @brief Number of elements enforce_all() checks between two tests
+         *        for a failure
+         * @internal
+         */
+        inline constexpr std::size_t bulk_check_block = 256;
+
+        /**
+         * @brief Whether std::data() and std::size() apply to a range
+         * @internal
+         */
+        template<typename Range, typename = void>
+        struct is_contiguous_range : std::false_type {};
+
+        template<typename Range>
+        struct is_contiguous_range<Range, std::void_t<
+            decltype(std::data(std::declval<Range&>())),
+            decltype(std::size(std::declval<Range&>()))>> : std::true_type {};
+
+        /**
+         * @brief Check all elements of a range without a branch per element
+         *
+         * The predicate results are combined with `|` so the loop over a
+         * contiguous range can be vectorized; the result is tested once per
+         * block of bulk_check_block elements.
+         * @internal
+         */
+        template<typename Range, typename Predicate>
+        bool all_elements_pass(const Range& range, const Predicate& pred) {
+            if constexpr (is_contiguous_range<const Range>::value) {
+                const auto* data = std::data(range);
+                const std::size_t size = std::size(range);
+                std::size_t start = 0;
+                // Full blocks have a constant trip count, which even the
+                // cheap vectorizer of GCC -O2 accepts
+                for (; size - start >= bulk_check_block; start += bulk_check_block) {
+                    // An unsigned reduction; compilers do not vectorize bool ones
+                    unsigned failed = 0;
+                    for (std::size_t i = 0; i < bulk_check_block; ++i) {
+                        failed |= static_cast<unsigned>(!pred.check(data[start + i]));
+                    }
+                    if (FAILSAFE_UNLIKELY(failed != 0)) {
+                        return false;
+                    }
+                }
+                unsigned failed = 0;
+                for (; start < size; ++start) {
+                    failed |= static_cast<unsigned>(!pred.check(data[start]));
+                }
+                return failed == 0;
+            } else {
+                unsigned failed = 0;
+                for (const auto& element : range) {
+                    failed |= static_cast<unsigned>(!pred.check(element));
+                }
+                return failed == 0;
+            }
+        }
+
+        /**
+         * @brief Find the first element failing the predicate and raise
+         *
+         * Out of line and cold; only called once all_elements_pass() failed.
+         * @internal
+         */
+        template<typename Raiser, typename Range, typename Predicate>
+        FAILSAFE_NOINLINE FAILSAFE_COLD
+        void raise_first_bulk_failure(const Range& range, const Predicate& pred,
+                                      const char* expr, const char* file, int line) {
+            std::size_t index = 0;
+            for (const auto& element : range) {
+                if (!pred.check(element)) {
+                    failsafe::detail::throw_expression_scope counted_as(expr);
+                    ::failsafe::exception::internal::raise_site_scope raised_for(FAILSAFE_RETURN_ADDRESS());
+                    Raiser::raise(file, line, "Enforcement failed: ", expr, " - ", pred.description(),
+                                  " - element", index, "is", element);
+                    return;
+                }
+                ++index;
+            }
+        }
+    } // namespace internal
     
     /**
      * @brief Main enforcer class
      * 
      * Validates a value using a predicate and handles failures using a raiser.
      * Can be used with implicit conversion to get the validated value.
+     *
+     * The predicate is evaluated by the factory functions. A failed check
+     * stays pending until the first of:
+     * - operator(), which raises with the custom message
+     * - access to the value (conversion or get()), which raises the default
+     *   message before the value can be used
+     * - the end of the full expression (destructor), which raises the
+     *   default message; if another exception thrown since the check is
+     *   propagating, it is printed instead
+     *
+     * Raising is done by out of line cold functions; for a passing check
+     * only the predicate test and the value remain after inlining.
+     *
+     * The factory functions bind lvalues by reference and move rvalues into
+     * the enforcer, so no copy is made: get() returns the enforced object
+     * itself, and converting a temporary enforcer moves the value out, which
+     * also works for move-only types.
      * 
-     * @tparam T The type of value being enforced
+     * @tparam T The type of value being enforced: an lvalue reference type
+     *           for enforced lvalues, an object type for rvalues
      * @tparam Predicate The predicate policy (default: truth)
      * @tparam Raiser The raiser policy (default: default_raiser)
      */
@@ -235,55 +464,54 @@ namespace failsafe::enforce {
     public:
         /**
          * @brief Constructor for simple enforcement
-         * @param value The value to enforce
+         * @param value The value to enforce (moved in unless T is a reference)
          * @param passed Whether the predicate passed
          * @param expr String representation of the expression
          * @param file Source file name
          * @param line Source line number
          */
-        enforcer(T value, bool passed, const char* expr, 
+        enforcer(T&& value, bool passed, const char* expr, 
                 const char* file, int line)
-            : value_(std::move(value))
+            : value_(std::forward<T>(value))
             , expr_(expr)
             , file_(file)
             , line_(line)
-            , failed_(!passed) {
+            , description_(Predicate{}.description())
+            , pending_(!passed)
+            , uncaught_(passed ? 0 : std::uncaught_exceptions()) {
         }
         
         /**
          * @brief Constructor with predicate instance
-         * @param value The value to enforce
+         * @param value The value to enforce (moved in unless T is a reference)
          * @param passed Whether the predicate passed
-         * @param pred The predicate instance
+         * @param pred The predicate instance; only its description is kept
          * @param expr String representation of the expression
          * @param file Source file name
          * @param line Source line number
          */
-        enforcer(T value, bool passed, const Predicate& pred, 
+        enforcer(T&& value, bool passed, const Predicate& pred, 
                 const char* expr, const char* file, int line)
-            : value_(std::move(value))
-            , predicate_(pred)
+            : value_(std::forward<T>(value))
             , expr_(expr)
             , file_(file)
             , line_(line)
-            , failed_(!passed) {
+            , description_(pred.description())
+            , pending_(!passed)
+            , uncaught_(passed ? 0 : std::uncaught_exceptions()) {
         }
         
+        enforcer(const enforcer&) = default;
+        enforcer(enforcer&&) = default;
+
         /**
-         * @brief Destructor - triggers enforcement if no custom message provided
+         * @brief Destructor - raises the default message of a failed check
+         *        that was neither given a custom message nor accessed
          * @throws Exception type determined by Raiser if enforcement failed
          */
-        ~enforcer() noexcept(false) {
-            if (failed_ && !handled_) {
-                // Mark as handled to prevent double-throw
-                handled_ = true;
-                if constexpr (std::is_same_v<Predicate, predicates::truth>) {
-                    Raiser::raise(file_, line_, "Enforcement failed: ", expr_, 
-                                 " - ", Predicate::description());
-                } else {
-                    Raiser::raise(file_, line_, "Enforcement failed: ", expr_, 
-                                 " - ", predicate_.description());
-                }
+        FAILSAFE_ALWAYS_INLINE ~enforcer() noexcept(false) {
+            if (FAILSAFE_UNLIKELY(pending_)) {
+                internal::raise_default_message_on_exit<Raiser>(file_, line_, expr_, description_, uncaught_);
             }
         }
         
@@ -298,42 +526,93 @@ namespace failsafe::enforce {
          * @throws Exception immediately with custom message if enforcement failed
          */
         template<typename... Args>
-        enforcer& operator()(Args&&... args) {
-            if (failed_) {
-                handled_ = true;
+        enforcer& operator()(Args&&... args) & {
+            if (FAILSAFE_UNLIKELY(pending_)) {
+                pending_ = false;
+                failsafe::detail::throw_expression_scope counted_as(expr_);
                 Raiser::raise(file_, line_, std::forward<Args>(args)...);
             }
             return *this;
         }
+
+        /**
+         * @brief Provide custom error message (temporary enforcer)
+         * @return Rvalue reference to this enforcer, so the value can still
+         *         be moved out
+         */
+        template<typename... Args>
+        enforcer&& operator()(Args&&... args) && {
+            return std::move(this->operator()(std::forward<Args>(args)...));
+        }
         
         /**
          * @brief Implicit conversion to the enforced value
-         * @return The validated value
+         * @return The validated value (a copy, or the reference if T is one)
+         * @throws Exception with the default message if enforcement failed
          */
-        operator T() const {
+        operator T() const& {
+            check();
             return value_;
         }
+
+        /**
+         * @brief Implicit conversion of a temporary enforcer
+         * @return The validated value, moved out (the reference if T is one)
+         * @throws Exception with the default message if enforcement failed
+         */
+        operator T() && {
+            check();
+            return static_cast<T&&>(value_);
+        }
         
         /**
          * @brief Get the value explicitly
-         * @return Reference to the validated value
+         * @return Reference to the validated value; the enforced object
+         *         itself for lvalues
+         * @throws Exception with the default message if enforcement failed
          */
-        T& get() { return value_; }
+        T& get() & {
+            check();
+            return value_;
+        }
         
         /**
          * @brief Get the value explicitly (const)
          * @return Const reference to the validated value
+         * @throws Exception with the default message if enforcement failed
+         */
+        const T& get() const& {
+            check();
+            return value_;
+        }
+
+        /**
+         * @brief Get the value of a temporary enforcer
+         * @return Rvalue reference to the validated value (the reference if
+         *         T is one); valid until the end of the full expression
+         * @throws Exception with the default message if enforcement failed
          */
-        const T& get() const { return value_; }
+        T&& get() && {
+            check();
+            return static_cast<T&&>(value_);
+        }
         
     private:
+        FAILSAFE_ALWAYS_INLINE void check() const {
+            if (FAILSAFE_UNLIKELY(pending_)) {
+                // Raised here, not again by the destructor
+                pending_ = false;
+                internal::raise_default_message<Raiser>(file_, line_, expr_, description_);
+            }
+        }
+
         T value_;
-        Predicate predicate_;
         const char* expr_;
         const char* file_;
         int line_;
-        bool failed_;
-        bool handled_ = false;
+        const char* description_;
+        mutable bool pending_;
+        int uncaught_; ///< std::uncaught_exceptions() when the check failed
     };
     
     /**
@@ -349,7 +628,7 @@ namespace failsafe::enforce {
     template<typename T>
     auto make_enforcer(T&& value, const char* expr, const char* file, int line) {
         bool passed = predicates::truth::check(value);
-        return enforcer<std::decay_t<T>>(
+        return enforcer<T>(
             std::forward<T>(value), passed, expr, file, line);
     }
     
@@ -360,7 +639,7 @@ namespace failsafe::enforce {
     template<typename Exception, typename T>
     auto make_enforcer_throw(T&& value, const char* expr, const char* file, int line) {
         bool passed = predicates::truth::check(value);
-        return enforcer<std::decay_t<T>, predicates::truth, 
+        return enforcer<T, predicates::truth, 
                        raisers::exception_raiser<Exception>>(
             std::forward<T>(value), passed, expr, file, line);
     }
@@ -372,7 +651,7 @@ namespace failsafe::enforce {
     template<typename T>
     auto make_enforcer_trap(T&& value, const char* expr, const char* file, int line) {
         bool passed = predicates::truth::check(value);
-        return enforcer<std::decay_t<T>, predicates::truth, raisers::trap_raiser>(
+        return enforcer<T, predicates::truth, raisers::trap_raiser>(
             std::forward<T>(value), passed, expr, file, line);
     }
     
@@ -384,7 +663,7 @@ namespace failsafe::enforce {
     auto enforce_eq(T&& value, U&& expected, const char* expr, const char* file, int line) {
         predicates::equal_to<std::decay_t<U>> pred{expected};
         bool passed = pred.check(value);
-        return enforcer<std::decay_t<T>, predicates::equal_to<std::decay_t<U>>>(
+        return enforcer<T, predicates::equal_to<std::decay_t<U>>>(
             std::forward<T>(value), passed, pred, expr, file, line);
     }
     
@@ -396,7 +675,7 @@ namespace failsafe::enforce {
     auto enforce_ne(T&& value, U&& expected, const char* expr, const char* file, int line) {
         predicates::not_equal_to<std::decay_t<U>> pred{expected};
         bool passed = pred.check(value);
-        return enforcer<std::decay_t<T>, predicates::not_equal_to<std::decay_t<U>>>(
+        return enforcer<T, predicates::not_equal_to<std::decay_t<U>>>(
             std::forward<T>(value), passed, pred, expr, file, line);
     }
     
@@ -408,7 +687,7 @@ namespace failsafe::enforce {
     auto enforce_lt(T&& value, U&& bound, const char* expr, const char* file, int line) {
         predicates::less_than<std::decay_t<U>> pred{bound};
         bool passed = pred.check(value);
-        return enforcer<std::decay_t<T>, predicates::less_than<std::decay_t<U>>>(
+        return enforcer<T, predicates::less_than<std::decay_t<U>>>(
             std::forward<T>(value), passed, pred, expr, file, line);
     }
     
@@ -420,7 +699,7 @@ namespace failsafe::enforce {
     auto enforce_gt(T&& value, U&& bound, const char* expr, const char* file, int line) {
         predicates::greater_than<std::decay_t<U>> pred{bound};
         bool passed = pred.check(value);
-        return enforcer<std::decay_t<T>, predicates::greater_than<std::decay_t<U>>>(
+        return enforcer<T, predicates::greater_than<std::decay_t<U>>>(
             std::forward<T>(value), passed, pred, expr, file, line);
     }
     
@@ -433,149 +712,289 @@ namespace failsafe::enforce {
                          const char* expr, const char* file, int line) {
         predicates::in_range<std::decay_t<L>, std::decay_t<U>> pred{lower, upper};
         bool passed = pred.check(value);
-        return enforcer<std::decay_t<T>, predicates::in_range<std::decay_t<L>, std::decay_t<U>>>(
+        return enforcer<T, predicates::in_range<std::decay_t<L>, std::decay_t<U>>>(
             std::forward<T>(value), passed, pred, expr, file, line);
     }
     
     /** @} */ // end of EnforcerFactories group
-    
-} // namespace failsafe::enforce
 
-namespace failsafe::detail {
     /**
-     * @brief Helper function to check if an index is valid
-     * 
-     * For unsigned types, only checks upper bound.
-     * For signed types, checks both bounds.
+     * @defgroup BulkEnforcement Bulk Enforcement
+     * @brief Check every element of a range in one pass
+     *
+     * The predicate is evaluated for all elements without a branch per
+     * element, so the pass over contiguous ranges of arithmetic types can be
+     * vectorized. Only when an element fails is the range searched again
+     * for the first offending element, whose index and value are reported:
+     *
+     * @code
+     * ENFORCE_ALL_IN_RANGE(samples, -1.0f, 1.0f);
+     * // Enforcement failed:  all of samples in [-1.0f, 1.0f]  -  Value must be in range  - element 1042 is 1.5
+     * @endcode
+     *
+     * Failures are raised immediately; there is no custom message chaining.
+     * @{
      */
-    template<typename IndexT, typename SizeT>
-    inline constexpr bool is_valid_index(IndexT index, SizeT size) noexcept {
-        if constexpr (std::is_unsigned_v<IndexT>) {
-            return index < size;
-        } else {
-            return index >= 0 && static_cast<std::make_unsigned_t<IndexT>>(index) < size;
+
+    /**
+     * @brief Enforce a predicate on every element of a range
+     *
+     * @tparam Raiser The raiser policy (default: default_raiser)
+     * @param range Any range usable with range-based for
+     * @param pred Predicate policy (see failsafe::enforce::predicates)
+     * @param expr String representation of the expression
+     * @param file Source file name
+     * @param line Source line number
+     * @return The range, forwarded (a temporary stays valid until the end
+     *         of the full expression)
+     */
+    template<typename Raiser = raisers::default_raiser, typename Range, typename Predicate>
+    Range&& enforce_all(Range&& range, const Predicate& pred, const char* expr, const char* file, int line) {
+        if (FAILSAFE_UNLIKELY(!internal::all_elements_pass(range, pred))) {
+            internal::raise_first_bulk_failure<Raiser>(range, pred, expr, file, line);
         }
+        return std::forward<Range>(range);
     }
-} // namespace failsafe::detail
 
-/**
- * @defgroup EnforceMacros Enforcement Macros
- * @{
- */
+    /**
+     * @brief Enforce that every element is in [lower, upper]
+     * @internal
+     */
+    template<typename Range, typename L, typename U>
+    Range&& enforce_all_in_range(Range&& range, L&& lower, U&& upper,
+                                 const char* expr, const char* file, int line) {
+        return enforce_all(std::forward<Range>(range),
+                           predicates::in_range<std::decay_t<L>, std::decay_t<U>>{lower, upper},
+                           expr, file, line);
+    }
 
-/**
- * @brief Main enforcement macro
- * 
- * Validates expression and returns the value if true.
- * Throws FAILSAFE_DEFAULT_EXCEPTION on failure.
- * 
- * @param expr Expression to enforce
- * @return The value of expr if validation passes
- * 
- * @example
- * @code
- * auto ptr = ENFORCE(malloc(size));  // Throws on null
- * auto file = ENFORCE(fopen(path, "r"))("Failed to open:", path);
- * @endcode
- */
-#define ENFORCE(expr) \
-    ::failsafe::enforce::make_enforcer((expr), #expr, __FILE__, __LINE__)
+    /**
+     * @brief Enforce that every element is a valid index for size
+     * @internal
+     */
+    template<typename Range, typename Size>
+    Range&& enforce_all_valid_index(Range&& range, Size size, const char* expr, const char* file, int line) {
+        return enforce_all(std::forward<Range>(range), predicates::valid_index<Size>{size}, expr, file, line);
+    }
 
-/**
- * @brief Enforce with specific exception type
- * 
- * @param expr Expression to enforce
- * @param ExceptionType Exception type to throw on failure
- */
-#define ENFORCE_THROW(expr, ExceptionType) \
-    ::failsafe::enforce::make_enforcer_throw<ExceptionType>((expr), #expr, __FILE__, __LINE__)
+    /** @} */ // end of BulkEnforcement group
 
-/**
- * @brief Enforce that always traps to debugger
- * 
- * @param expr Expression to enforce
- */
-#define ENFORCE_TRAP(expr) \
-    ::failsafe::enforce::make_enforcer_trap((expr), #expr, __FILE__, __LINE__)
+    /**
+     * @defgroup ConstexprEnforcement Compile-Time Enforcement
+     * @brief Enforcement usable in constant expressions
+     *
+     * enforce_constexpr() and the ENFORCE_CONSTEXPR* macros can be used in
+     * constexpr functions. Evaluated in a constant expression, a failed
+     * check is a compile error: the failure path calls the non-constexpr
+     * constant_expression_enforcement_failed(), and the compiler reports
+     * that call together with the checked expression. Evaluated at run
+     * time, a failed check raises the default enforcement message like
+     * ENFORCE; a passing one costs the predicate test.
+     *
+     * @code
+     * constexpr std::size_t table_size(std::size_t bits) {
+     *     return std::size_t{1} << ENFORCE_CONSTEXPR_LT(bits, 32u);
+     * }
+     * static_assert(table_size(8) == 256);
+     * @endcode
+     *
+     * THROW_IF and TRAP_IF behave the same way in constexpr functions.
+     * @{
+     */
 
-/** @} */ // end of EnforceMacros group
+    namespace internal {
+        /**
+         * @brief Failure path of enforce_constexpr()
+         *
+         * Deliberately not constexpr, so that a check failing in a constant
+         * expression names this function in the compile error.
+         * @internal
+         */
+        template<typename Raiser>
+        void constant_expression_enforcement_failed(const char* file, int line, const char* expr,
+                                                    const char* description) {
+            raise_default_message<Raiser>(file, line, expr, description);
+        }
+    } // namespace internal
 
-/**
- * @defgroup ComparisonMacros Comparison Enforcement Macros
- * @{
- */
+    /**
+     * @brief Enforce a predicate, at compile time in constant expressions
+     *
+     * @tparam Raiser The raiser policy used at run time
+     * @param value The value to enforce
+     * @param pred Predicate policy with constexpr check() and description()
+     * @param expr String representation of the expression
+     * @param file Source file name
+     * @param line Source line number
+     * @return The value (a reference for lvalues)
+     */
+    template<typename Raiser = raisers::default_raiser, typename T, typename Predicate>
+    constexpr T enforce_constexpr(T&& value, const Predicate& pred, const char* expr, const char* file, int line) {
+        if (FAILSAFE_UNLIKELY(!pred.check(value))) {
+            internal::constant_expression_enforcement_failed<Raiser>(file, line, expr, pred.description());
+        }
+        return std::forward<T>(value);
+    }
+
+    /**
+     * @brief Enforce equality, at compile time in constant expressions
+     * @internal
+     */
+    template<typename T, typename U>
+    constexpr T enforce_constexpr_eq(T&& value, U&& expected, const char* expr, const char* file, int line) {
+        return enforce_constexpr(std::forward<T>(value), predicates::equal_to<std::decay_t<U>>{expected},
+                                 expr, file, line);
+    }
 
-/** @brief Enforce equality */
-#define ENFORCE_EQ(value, expected) \
-    ::failsafe::enforce::enforce_eq((value), (expected), #value " == " #expected, __FILE__, __LINE__)
+    /**
+     * @brief Enforce inequality, at compile time in constant expressions
+     * @internal
+     */
+    template<typename T, typename U>
+    constexpr T enforce_constexpr_ne(T&& value, U&& expected, const char* expr, const char* file, int line) {
+        return enforce_constexpr(std::forward<T>(value), predicates::not_equal_to<std::decay_t<U>>{expected},
+                                 expr, file, line);
+    }
 
-/** @brief Enforce inequality */
-#define ENFORCE_NE(value, expected) \
-    ::failsafe::enforce::enforce_ne((value), (expected), #value " != " #expected, __FILE__, __LINE__)
+    /**
+     * @brief Enforce less than, at compile time in constant expressions
+     * @internal
+     */
+    template<typename T, typename U>
+    constexpr T enforce_constexpr_lt(T&& value, U&& bound, const char* expr, const char* file, int line) {
+        return enforce_constexpr(std::forward<T>(value), predicates::less_than<std::decay_t<U>>{bound},
+                                 expr, file, line);
+    }
+
+    /**
+     * @brief Enforce greater than, at compile time in constant expressions
+     * @internal
+     */
+    template<typename T, typename U>
+    constexpr T enforce_constexpr_gt(T&& value, U&& bound, const char* expr, const char* file, int line) {
+        return enforce_constexpr(std::forward<T>(value), predicates::greater_than<std::decay_t<U>>{bound},
+                                 expr, file, line);
+    }
+
+    /**
+     * @brief Enforce less than or equal, at compile time in constant expressions
+     * @internal
+     */
+    template<typename T, typename U>
+    constexpr T enforce_constexpr_le(T&& value, U&& bound, const char* expr, const char* file, int line) {
+        return enforce_constexpr(std::forward<T>(value), predicates::less_equal<std::decay_t<U>>{bound},
+                                 expr, file, line);
+    }
 
-/** @brief Enforce less than */
-#define ENFORCE_LT(value, bound) \
-    ::failsafe::enforce::enforce_lt((value), (bound), #value " < " #bound, __FILE__, __LINE__)
+    /**
+     * @brief Enforce greater than or equal, at compile time in constant expressions
+     * @internal
+     */
+    template<typename T, typename U>
+    constexpr T enforce_constexpr_ge(T&& value, U&& bound, const char* expr, const char* file, int line) {
+        return enforce_constexpr(std::forward<T>(value), predicates::greater_equal<std::decay_t<U>>{bound},
+                                 expr, file, line);
+    }
 
-/** @brief Enforce greater than */
-#define ENFORCE_GT(value, bound) \
-    ::failsafe::enforce::enforce_gt((value), (bound), #value " > " #bound, __FILE__, __LINE__)
+    /**
+     * @brief Enforce in range, at compile time in constant expressions
+     * @internal
+     */
+    template<typename T, typename L, typename U>
+    constexpr T enforce_constexpr_in_range(T&& value, L&& lower, U&& upper,
+                                           const char* expr, const char* file, int line) {
+        return enforce_constexpr(std::forward<T>(value),
+                                 predicates::in_range<std::decay_t<L>, std::decay_t<U>>{lower, upper},
+                                 expr, file, line);
+    }
 
-/** @brief Enforce less than or equal */
-#define ENFORCE_LE(value, bound) \
-    ENFORCE((value) <= (bound))
+    /** @} */ // end of ConstexprEnforcement group
 
-/** @brief Enforce greater than or equal */
-#define ENFORCE_GE(value, bound) \
-    ENFORCE((value) >= (bound))
+    /**
+     * @defgroup ResultEnforcement Enforcement Without Exceptions
+     * @brief Enforcement reporting failures as failsafe::result
+     *
+     * The ENFORCE_RESULT* macros check the same predicates as ENFORCE, but
+     * return a failsafe::result instead of raising: a passing check holds
+     * the value (copied or moved in), a failing one a failsafe::error with
+     * the call site and predicate description. Nothing is formatted unless
+     * the error's message is requested, so the failure path is cheap enough
+     * for expected failures, and none of it needs exceptions.
+     *
+     * These are not raiser policies: a raiser never returns, while the
+     * result has to be passed back to the caller.
+     *
+     * @code
+     * failsafe::result<int> parse_port(std::string_view text) {
+     *     ASSIGN_OR_PROPAGATE(int port, parse_int(text));
+     *     return ENFORCE_RESULT_IN_RANGE(port, 1, 65535)("Invalid port:", text);
+     * }
+     * @endcode
+     * @{
+     */
 
-/** @brief Enforce value in range [lower, upper] */
-#define ENFORCE_IN_RANGE(value, lower, upper) \
-    ::failsafe::enforce::enforce_in_range((value), (lower), (upper), \
-        #value " in [" #lower ", " #upper "]", __FILE__, __LINE__)
+    /**
+     * @brief Check a predicate and return the value or an error
+     *
+     * @param value The value to check
+     * @param pred Predicate policy (see failsafe::enforce::predicates)
+     * @param site The call site, from FAILSAFE_ERROR_SITE
+     * @return The value, or an error with the default enforcement message
+     */
+    template<typename T, typename Predicate>
+    result<std::decay_t<T>> enforce_result(T&& value, const Predicate& pred, const error_site& site) {
+        if (FAILSAFE_UNLIKELY(!pred.check(value))) {
+            return failsafe::error(site, pred.description());
+        }
+        return std::forward<T>(value);
+    }
 
-/** @} */ // end of ComparisonMacros group
+    /**
+     * @brief Check equality, returning a result
+     * @internal
+     */
+    template<typename T, typename U>
+    result<std::decay_t<T>> enforce_result_eq(T&& value, U&& expected, const error_site& site) {
+        return enforce_result(std::forward<T>(value), predicates::equal_to<std::decay_t<U>>{expected}, site);
+    }
 
-/**
- * @defgroup SpecializedMacros Specialized Enforcement Macros
- * @{
- */
+    /**
+     * @brief Check inequality, returning a result
+     * @internal
+     */
+    template<typename T, typename U>
+    result<std::decay_t<T>> enforce_result_ne(T&& value, U&& expected, const error_site& site) {
+        return enforce_result(std::forward<T>(value), predicates::not_equal_to<std::decay_t<U>>{expected}, site);
+    }
 
-/**
- * @brief Enforce non-null pointer
- * 
- * @param ptr Pointer to check
- * @example
- * @code
- * auto buffer = ENFORCE_NOT_NULL(malloc(size));
- * @endcode
- */
-#define ENFORCE_NOT_NULL(ptr) \
-    ENFORCE(ptr)("Null pointer: " #ptr)
+    /**
+     * @brief Check less than, returning a result
+     * @internal
+     */
+    template<typename T, typename U>
+    result<std::decay_t<T>> enforce_result_lt(T&& value, U&& bound, const error_site& site) {
+        return enforce_result(std::forward<T>(value), predicates::less_than<std::decay_t<U>>{bound}, site);
+    }
 
-/**
- * @brief Enforce valid array index
- * 
- * @param index Index to validate
- * @param size Array size
- * 
- * For unsigned types, only checks upper bound. For signed types, checks both bounds.
- */
-#define ENFORCE_VALID_INDEX(index, size) \
-    ENFORCE(::failsafe::detail::is_valid_index(index, size))("Index out of bounds: ", (index), " not in [0, ", (size), ")")
+    /**
+     * @brief Check greater than, returning a result
+     * @internal
+     */
+    template<typename T, typename U>
+    result<std::decay_t<T>> enforce_result_gt(T&& value, U&& bound, const error_site& site) {
+        return enforce_result(std::forward<T>(value), predicates::greater_than<std::decay_t<U>>{bound}, site);
+    }
 
-/**
- * @brief Debug-only enforcement
- * 
- * Like assert() but with better error messages.
- * Compiled out in release builds.
- * 
- * @param expr Expression to enforce in debug builds
- */
-#ifdef NDEBUG
-    #define DEBUG_ENFORCE(expr) ((void)0)
-#else
-    #define DEBUG_ENFORCE(expr) ENFORCE_TRAP(expr)
-#endif
+    /**
+     * @brief Check in range, returning a result
+     * @internal
+     */
+    template<typename T, typename L, typename U>
+    result<std::decay_t<T>> enforce_result_in_range(T&& value, L&& lower, U&& upper, const error_site& site) {
+        return enforce_result(std::forward<T>(value),
+                              predicates::in_range<std::decay_t<L>, std::decay_t<U>>{lower, upper}, site);
+    }
 
-/** @} */ // end of SpecializedMacros group
\ No newline at end of file
+    /** @} */ // end of ResultEnforcement group
+    
+} // namespace failsafe::enforce
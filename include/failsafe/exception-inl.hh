@@ -0,0 +1,202 @@
+/**
+ * @file exception-inl.hh
+ * @brief Definitions of the non-template exception.hh functions
+ *
+ * @note Included by exception.hh in header-only mode and compiled into
+ *       failsafe_impl otherwise, see detail/export.hh.
+ */
+#pragma once
+
+#include <failsafe/exception.hh>
+
+#include <atomic>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <string>
+
+namespace failsafe::exception {
+
+    namespace internal {
+        FAILSAFE_INLINE void print_exception_info(const char* file, int line, const std::string& message) {
+            std::cerr << "\n=== EXCEPTION TRAP ===\n"
+                << "Location: " << failsafe::detail::format_location(file, line) << "\n"
+                << "Message: " << message << "\n"
+                << "======================\n" << std::flush;
+        }
+
+        FAILSAFE_INLINE FAILSAFE_COLD FAILSAFE_NOINLINE
+        void trap_from_args(const char* file, int line, failsafe::detail::format_args args) {
+            print_exception_info(file, line, failsafe::detail::build_message_from_args(args));
+            psnip_trap();
+            std::terminate();
+        }
+    } // namespace failsafe::exception::internal
+
+    /**
+     * @brief Captured location and arguments of a lazy_error
+     *
+     * `message` is built once.
+     */
+    struct lazy_error::state {
+        const char* file = nullptr;
+        int line = 0;
+        failsafe::detail::captured_args args;
+        std::once_flag formatted;
+        std::string message;
+    };
+
+    FAILSAFE_INLINE lazy_error::lazy_error(const char* file, int line, failsafe::detail::captured_args args)
+        : state_(std::make_shared <state>()) {
+        state_->file = file;
+        state_->line = line;
+        state_->args = std::move(args);
+    }
+
+    FAILSAFE_INLINE const char* lazy_error::what() const noexcept {
+#if FAILSAFE_HAS_EXCEPTIONS
+        try {
+#endif
+            std::call_once(state_->formatted, [this] {
+                state_->message = failsafe::detail::format_location_with_separator(state_->file, state_->line) +
+                                  state_->args.str();
+            });
+            return state_->message.c_str();
+#if FAILSAFE_HAS_EXCEPTIONS
+        } catch (...) {
+            return "failsafe::exception::lazy_error (message formatting failed)";
+        }
+#endif
+    }
+
+    FAILSAFE_INLINE const char* lazy_error::file() const noexcept {
+        return state_->file;
+    }
+
+    FAILSAFE_INLINE int lazy_error::line() const noexcept {
+        return state_->line;
+    }
+
+    namespace internal {
+        FAILSAFE_INLINE std::atomic <stack_capture>& stack_capture_mode() noexcept {
+            static std::atomic <stack_capture> mode{stack_capture::off};
+            return mode;
+        }
+    } // namespace failsafe::exception::internal
+
+    FAILSAFE_INLINE void set_stack_capture(stack_capture mode) noexcept {
+        internal::stack_capture_mode().store(mode, std::memory_order_relaxed);
+    }
+
+    FAILSAFE_INLINE stack_capture get_stack_capture() noexcept {
+        return internal::stack_capture_mode().load(std::memory_order_relaxed);
+    }
+
+    namespace internal {
+        FAILSAFE_INLINE std::atomic <bool>& chain_recording() noexcept {
+            static std::atomic <bool> enabled{false};
+            return enabled;
+        }
+    } // namespace failsafe::exception::internal
+
+    FAILSAFE_INLINE void set_chain_recording(bool enabled) noexcept {
+        internal::chain_recording().store(enabled, std::memory_order_relaxed);
+    }
+
+    FAILSAFE_INLINE bool get_chain_recording() noexcept {
+        return internal::chain_recording().load(std::memory_order_relaxed);
+    }
+
+    namespace internal {
+        FAILSAFE_INLINE last_throw& last_failsafe_throw() noexcept {
+            static thread_local last_throw last;
+            return last;
+        }
+
+        FAILSAFE_INLINE const void*& current_raise_site() noexcept {
+            static thread_local const void* site = nullptr;
+            return site;
+        }
+
+        FAILSAFE_INLINE FAILSAFE_NOINLINE void capture_stack(trace_node& node, const void* return_address) noexcept {
+            // Skip this function, then the frames up to the THROW/ENFORCE site
+            switch (get_stack_capture()) {
+                case stack_capture::off:
+                    return;
+                case stack_capture::frame_pointers:
+                    node.stack.capture_frame_pointers(1);
+                    break;
+                case stack_capture::unwinder:
+                    node.stack.capture_unwinder(1);
+                    break;
+            }
+            const void* site = current_raise_site();
+            node.stack.start_at(site != nullptr ? site : return_address);
+        }
+
+        FAILSAFE_INLINE void append_trace_line(std::string& out, unsigned int indent_level, const char* what) {
+            out.append(indent_level * 2u, ' ');
+            out += "→ ";
+            out += what;
+            out += '\n';
+        }
+
+        FAILSAFE_INLINE void append_nested_trace(std::string& out, const std::exception& e, unsigned int indent_level) {
+            std::exception_ptr nested;
+            if (const auto* link = dynamic_cast<const trace_link*>(&e)) {
+                // Chain recorded by THROW: size the messages, then copy them
+                // (call stacks, if captured, are symbolized while appending)
+                std::size_t size = 0;
+                unsigned int level = indent_level;
+                for (const trace_node* node = &link->trace(); node; node = node->next.get(), ++level) {
+                    size += level * 2u + std::strlen(node->exception().what()) + 5u;
+                }
+                out.reserve(out.size() + size);
+
+                const trace_node* node = &link->trace();
+                for (;; node = node->next.get(), ++indent_level) {
+                    append_trace_line(out, indent_level, node->exception().what());
+                    node->stack.append_to(out, indent_level + 1);
+                    if (!node->next) {
+                        break;
+                    }
+                }
+                nested = node->foreign;
+            } else {
+                append_trace_line(out, indent_level, e.what());
+                // Use dynamic_cast to check for nested_exception - safer than rethrow_if_nested
+                // on some platforms (notably clang-cl on Windows)
+                if (const auto* nested_ptr = dynamic_cast<const std::nested_exception*>(&e)) {
+                    nested = nested_ptr->nested_ptr();
+                }
+            }
+
+            // Exceptions not thrown by THROW can only be inspected by rethrowing them
+#if FAILSAFE_HAS_EXCEPTIONS
+            if (nested) {
+                try {
+                    std::rethrow_exception(nested);
+                } catch (const std::exception& inner) {
+                    append_nested_trace(out, inner, indent_level + 1);
+                } catch (...) {
+                    out.append((indent_level + 1) * 2u, ' ');
+                    out += "→ [unknown nested exception]\n";
+                }
+            }
+#endif
+        }
+    } // namespace failsafe::exception::internal
+
+    FAILSAFE_INLINE std::string get_nested_trace(const std::exception& e, unsigned int indent_level) {
+        std::string result;
+        internal::append_nested_trace(result, e, indent_level);
+        return result;
+    }
+
+    FAILSAFE_INLINE void print_exception_trace(const std::exception& e) {
+        std::cerr << "\n=== Exception Trace ===\n" 
+                  << get_nested_trace(e)
+                  << "=====================\n" << std::flush;
+    }
+
+} // namespace failsafe::exception
@@ -23,6 +23,9 @@
 #include <failsafe/logger.hh>
 #include <failsafe/enforce.hh>
 #include <failsafe/exception.hh>
+#include <failsafe/result.hh>
+#include <failsafe/status.hh>
+#include <failsafe/throw_stats.hh>
 
 // String utilities (also included by logger)
 #include <failsafe/detail/string_utils.hh>
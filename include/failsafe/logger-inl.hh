@@ -0,0 +1,60 @@
+/**
+ * @file logger-inl.hh
+ * @brief Definitions of the non-template logger.hh functions
+ *
+ * @note Included by logger.hh in header-only mode and compiled into
+ *       failsafe_impl otherwise, see detail/export.hh.
+ */
+#pragma once
+
+#include <failsafe/logger.hh>
+
+#include <iostream>
+#include <mutex>
+
+namespace failsafe::logger {
+
+    namespace internal {
+#ifndef FAILSAFE_HEADER_ONLY
+        std::atomic <int> runtime_min_level{LOGGER_LEVEL_TRACE};
+#endif
+
+        FAILSAFE_INLINE void default_cerr_backend(int level, const char* category,
+                                                  const char* file, int line,
+                                                  const std::string& message) {
+            // Use a static mutex for thread safety
+            static std::mutex cerr_mutex;
+            std::lock_guard <std::mutex> lock(cerr_mutex);
+
+            std::cerr << "[" << level_to_string(level) << "] "
+                << "[" << category << "] "
+                << ::failsafe::detail::format_location(file, line) << " - "
+                << message << std::endl;
+        }
+
+        FAILSAFE_INLINE FAILSAFE_COLD FAILSAFE_NOINLINE void dispatch_message(int level, const char* category,
+                                                                              const char* file, int line,
+                                                                              const std::string& message) {
+            get_config().backend(level, category, file, line, message);
+        }
+    }
+
+    FAILSAFE_INLINE LoggerConfig& get_config() {
+        static LoggerConfig config;
+        return config;
+    }
+
+    FAILSAFE_INLINE void set_backend(LoggerBackend backend) {
+        if (backend) {
+            get_config().backend = std::move(backend);
+        } else {
+            // Reset to default if null backend provided
+            get_config().backend = internal::default_cerr_backend;
+        }
+    }
+
+    FAILSAFE_INLINE void reset_backend() {
+        get_config().backend = internal::default_cerr_backend;
+    }
+
+} // namespace failsafe::logger
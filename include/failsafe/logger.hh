@@ -33,6 +33,9 @@
  * // Conditional logging
  * LOG_IF(verbose_mode, LOGGER_LEVEL_TRACE, "Detailed state:", state);
  * 
+ * // Compile-time checked format strings (C++20)
+ * LOG_INFO_F("took {} ms for {}", ms, name);
+ * 
  * // Custom backend
  * logger::set_backend([](int level, const char* cat, const char* file, 
  *                       int line, const std::string& msg) {
@@ -47,66 +50,16 @@
 #include <functional>
 #include <atomic>
 #include <string>
+#include <string_view>
 #include <iostream>
 #include <mutex>
 
+#include <failsafe/detail/attributes.hh>
+#include <failsafe/detail/export.hh>
 #include <failsafe/detail/string_utils.hh>
+#include <failsafe/detail/format_string.hh>
 #include <failsafe/detail/location_format.hh>
-
-/**
- * @defgroup LogLevels Logging Levels
- * @{
- */
-
-/** @brief Most detailed logging level for tracing execution flow */
-#define LOGGER_LEVEL_TRACE 0
-
-/** @brief Debug messages for development and troubleshooting */
-#define LOGGER_LEVEL_DEBUG 1
-
-/** @brief Informational messages about normal operation */
-#define LOGGER_LEVEL_INFO  2
-
-/** @brief Warning messages for potentially problematic situations */
-#define LOGGER_LEVEL_WARN  3
-
-/** @brief Error messages for recoverable errors */
-#define LOGGER_LEVEL_ERROR 4
-
-/** @brief Fatal error messages for unrecoverable errors */
-#define LOGGER_LEVEL_FATAL 5
-
-/** @} */ // end of LogLevels group
-
-/**
- * @brief Minimum compile-time log level
- * 
- * Messages below this level are completely removed at compile time.
- * Default is TRACE level (all levels enabled). Can be overridden by defining before including this header.
- * For production builds, consider setting this to LOGGER_LEVEL_INFO or higher to remove debug/trace logs.
- */
-#ifndef LOGGER_MIN_LEVEL
-#define LOGGER_MIN_LEVEL LOGGER_LEVEL_TRACE
-#endif
-
-/** @internal Stringification helper macro */
-#define LOGGER_STRINGIFY(x) #x
-
-/** @internal Stringification helper macro */
-#define LOGGER_TOSTRING(x) LOGGER_STRINGIFY(x)
-
-/**
- * @brief Default logging category
- * 
- * Used when no category is specified. Default is "Application".
- * Can be overridden by defining before including this header.
- */
-#ifndef LOGGER_DEFAULT_CATEGORY
-    #define LOGGER_DEFAULT_CATEGORY Application
-#endif
-
-/** @internal Create string from category macro */
-#define LOGGER_DEFAULT_CATEGORY_STR LOGGER_TOSTRING(LOGGER_DEFAULT_CATEGORY)
+#include <failsafe/detail/logger_macros.hh>
 
 /**
  * @namespace failsafe::logger
@@ -148,18 +101,9 @@ namespace failsafe::logger {
          * @param line Source line number
          * @param message The formatted log message
          */
-        inline void default_cerr_backend(int level, const char* category,
-                                         const char* file, int line,
-                                         const std::string& message) {
-            // Use a static mutex for thread safety
-            static std::mutex cerr_mutex;
-            std::lock_guard <std::mutex> lock(cerr_mutex);
-
-            std::cerr << "[" << level_to_string(level) << "] "
-                << "[" << category << "] "
-                << ::failsafe::detail::format_location(file, line) << " - "
-                << message << std::endl;
-        }
+        FAILSAFE_API void default_cerr_backend(int level, const char* category,
+                                               const char* file, int line,
+                                               const std::string& message);
     }
 
     /**
@@ -182,6 +126,21 @@ namespace failsafe::logger {
         const std::string& message // Concatenated message
     )>;
 
+    namespace internal {
+        /**
+         * @brief Storage of LoggerConfig::min_level
+         *
+         * A constant-initialized namespace scope variable: the level check
+         * inlined at every LOG_* call site reads it directly, without the
+         * static initialization guard of get_config().
+         */
+#ifdef FAILSAFE_HEADER_ONLY
+        inline std::atomic <int> runtime_min_level{LOGGER_LEVEL_TRACE};
+#else
+        FAILSAFE_API extern std::atomic <int> runtime_min_level;
+#endif
+    }
+
     /**
      * @brief Logger configuration structure
      *
@@ -196,7 +155,7 @@ namespace failsafe::logger {
         LoggerBackend backend = internal::default_cerr_backend;
 
         /** @brief Minimum runtime log level (atomic for thread safety) */
-        std::atomic <int> min_level{LOGGER_LEVEL_TRACE};
+        std::atomic <int>& min_level = internal::runtime_min_level;
 
         /** @brief Whether logging is enabled (atomic for thread safety) */
         std::atomic <bool> enabled{true};
@@ -206,10 +165,7 @@ namespace failsafe::logger {
      * @brief Get global logger configuration
      * @return Reference to the global logger configuration
      */
-    inline LoggerConfig& get_config() {
-        static LoggerConfig config;
-        return config;
-    }
+    FAILSAFE_API LoggerConfig& get_config();
 
     /**
      * @brief Set a new logger backend
@@ -233,14 +189,7 @@ namespace failsafe::logger {
      * logger::set_backend(failsafe::logger::backends::make_cerr_backend(true, true, true));
      * @endcode
      */
-    inline void set_backend(LoggerBackend backend) {
-        if (backend) {
-            get_config().backend = std::move(backend);
-        } else {
-            // Reset to default if null backend provided
-            get_config().backend = internal::default_cerr_backend;
-        }
-    }
+    FAILSAFE_API void set_backend(LoggerBackend backend);
 
     /**
      * @brief Reset logger backend to default (cerr)
@@ -252,9 +201,7 @@ namespace failsafe::logger {
      * logger::set_backend(failsafe::logger::backends::make_cerr_backend(true, true, true));
      * @endcode
      */
-    inline void reset_backend() {
-        get_config().backend = internal::default_cerr_backend;
-    }
+    FAILSAFE_API void reset_backend();
 
     /**
      * @brief Set minimum log level at runtime
@@ -296,6 +243,36 @@ namespace failsafe::logger {
      * @brief Internal logging implementation
      */
     namespace internal {
+        /**
+         * @brief Pass a built message to the current backend
+         *
+         * Not a template, so the backend call is emitted once per program
+         * rather than once per call site.
+         */
+        FAILSAFE_API void dispatch_message(int level, const char* category,
+                                           const char* file, int line,
+                                           const std::string& message);
+
+        /**
+         * @brief Build a message and pass it to the backend
+         *
+         * Kept out of line and marked cold: callers only contain the call,
+         * not the message building code.
+         *
+         * @tparam Args Variadic template arguments for message building
+         * @param level Log level
+         * @param category Log category
+         * @param file Source file
+         * @param line Source line
+         * @param args Message arguments to concatenate
+         */
+        template<typename... Args>
+        FAILSAFE_COLD FAILSAFE_NOINLINE void log_message(int level, const char* category,
+                                                         const char* file, int line, Args&&... args) {
+            std::string message = failsafe::detail::build_message(std::forward <Args>(args)...);
+            dispatch_message(level, category, file, line, message);
+        }
+
         /**
          * @brief Core logging implementation
          * 
@@ -312,13 +289,11 @@ namespace failsafe::logger {
         inline void log_impl(int level, const char* category,
                              const char* file, int line, Args&&... args) {
             // Runtime check only
-            if (!is_level_enabled(level)) {
+            if (FAILSAFE_LIKELY(!is_level_enabled(level))) {
                 return;
             }
 
-            // Concatenate args and call backend
-            std::string message = failsafe::detail::build_message(std::forward <Args>(args)...);
-            get_config().backend(level, category, file, line, message);
+            log_message(level, category, file, line, std::forward <Args>(args)...);
         }
     }
 
@@ -337,191 +312,88 @@ namespace failsafe::logger {
      *
      * @note The LOG_* macros are conditionally defined based on LOGGER_MIN_LEVEL,
      *       so calls to this function are already filtered at compile time.
+     * @note Never inlined and marked cold: a LOG_* call site only contains
+     *       the runtime level check and this call, keeping hot functions
+     *       that log small.
      */
     template<int Level, typename... Args>
-    inline void log_with_level(const char* category, const char* file,
-                               int line, Args&&... args) {
-        internal::log_impl(Level, category, file, line, std::forward <Args>(args)...);
-    }
-}
-
-/**
- * @defgroup LogMacros Logging Macros
- * @{
- */
-
-/**
- * @brief Log a trace message with lazy evaluation
- * @param ... Variable arguments for message formatting
- * @note Arguments are only evaluated if TRACE level is enabled
- * @note Removed at compile time if LOGGER_MIN_LEVEL > TRACE
- */
-#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_TRACE
-#define LOG_TRACE(...) \
-    (::failsafe::logger::get_config().min_level.load() > LOGGER_LEVEL_TRACE) ? void() : \
-    (::failsafe::logger::log_with_level<LOGGER_LEVEL_TRACE>(LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__), void())
-#else
-#define LOG_TRACE(...) ((void)0)
-#endif
-
-/**
- * @brief Log a debug message with lazy evaluation
- * @param ... Variable arguments for message formatting
- * @note Arguments are only evaluated if DEBUG level is enabled
- * @note Removed at compile time if LOGGER_MIN_LEVEL > DEBUG
- */
-#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_DEBUG
-#define LOG_DEBUG(...) \
-    (::failsafe::logger::get_config().min_level.load() > LOGGER_LEVEL_DEBUG) ? void() : \
-    (::failsafe::logger::log_with_level<LOGGER_LEVEL_DEBUG>(LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__), void())
-#else
-#define LOG_DEBUG(...) ((void)0)
-#endif
-
-/**
- * @brief Log an informational message with lazy evaluation
- * @param ... Variable arguments for message formatting
- * @note Arguments are only evaluated if INFO level is enabled
- * @note Removed at compile time if LOGGER_MIN_LEVEL > INFO
- */
-#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_INFO
-#define LOG_INFO(...) \
-    (::failsafe::logger::get_config().min_level.load() > LOGGER_LEVEL_INFO) ? void() : \
-    (::failsafe::logger::log_with_level<LOGGER_LEVEL_INFO>(LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__), void())
-#else
-#define LOG_INFO(...) ((void)0)
-#endif
-
-/**
- * @brief Log a warning message with lazy evaluation
- * @param ... Variable arguments for message formatting
- * @note Arguments are only evaluated if WARN level is enabled
- * @note Removed at compile time if LOGGER_MIN_LEVEL > WARN
- */
-#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_WARN
-#define LOG_WARN(...) \
-    (::failsafe::logger::get_config().min_level.load() > LOGGER_LEVEL_WARN) ? void() : \
-    (::failsafe::logger::log_with_level<LOGGER_LEVEL_WARN>(LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__), void())
-#else
-#define LOG_WARN(...) ((void)0)
-#endif
-
-/**
- * @brief Log an error message with lazy evaluation
- * @param ... Variable arguments for message formatting
- * @note Arguments are only evaluated if ERROR level is enabled
- * @note Removed at compile time if LOGGER_MIN_LEVEL > ERROR
- */
-#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_ERROR
-#define LOG_ERROR(...) \
-    (::failsafe::logger::get_config().min_level.load() > LOGGER_LEVEL_ERROR) ? void() : \
-    (::failsafe::logger::log_with_level<LOGGER_LEVEL_ERROR>(LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__), void())
-#else
-#define LOG_ERROR(...) ((void)0)
-#endif
-
-/**
- * @brief Log a fatal error message with lazy evaluation
- * @param ... Variable arguments for message formatting
- * @note Arguments are only evaluated if FATAL level is enabled
- * @note Removed at compile time if LOGGER_MIN_LEVEL > FATAL
- */
-#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_FATAL
-#define LOG_FATAL(...) \
-    (::failsafe::logger::get_config().min_level.load() > LOGGER_LEVEL_FATAL) ? void() : \
-    (::failsafe::logger::log_with_level<LOGGER_LEVEL_FATAL>(LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__), void())
-#else
-#define LOG_FATAL(...) ((void)0)
-#endif
-
-/** @} */ // end of LogMacros group
+    FAILSAFE_COLD FAILSAFE_NOINLINE void log_with_level(const char* category, const char* file,
+                                                        int line, Args&&... args) {
+        if (!is_level_enabled(Level)) {
+            return;
+        }
 
-/**
- * @defgroup CategoryLogMacros Category-based Logging Macros
- * @{
- */
+        std::string message = failsafe::detail::build_message(std::forward <Args>(args)...);
+        internal::dispatch_message(Level, category, file, line, message);
+    }
 
-/**
- * @brief Log a trace message with custom category (lazy evaluation)
- * @param category The log category string
- * @param ... Variable arguments for message formatting
- */
-#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_TRACE
-#define LOG_CAT_TRACE(category, ...) \
-    (::failsafe::logger::get_config().min_level.load() > LOGGER_LEVEL_TRACE) ? void() : \
-    (::failsafe::logger::log_with_level<LOGGER_LEVEL_TRACE>(category, __FILE__, __LINE__, __VA_ARGS__), void())
-#else
-#define LOG_CAT_TRACE(category, ...) ((void)0)
-#endif
+#if LOGGER_HAS_CATEGORY_MIN_LEVELS
+    /**
+     * @brief Entry of the compile-time category level table
+     */
+    struct category_min_level {
+        std::string_view category; ///< Category name
+        int level; ///< Lowest level compiled in for the category
+    };
 
-/**
- * @brief Log a debug message with custom category (lazy evaluation)
- * @param category The log category string
- * @param ... Variable arguments for message formatting
- */
-#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_DEBUG
-#define LOG_CAT_DEBUG(category, ...) \
-    (::failsafe::logger::get_config().min_level.load() > LOGGER_LEVEL_DEBUG) ? void() : \
-    (::failsafe::logger::log_with_level<LOGGER_LEVEL_DEBUG>(category, __FILE__, __LINE__, __VA_ARGS__), void())
-#else
-#define LOG_CAT_DEBUG(category, ...) ((void)0)
+    /**
+     * @brief Table built from LOGGER_CATEGORY_MIN_LEVELS
+     */
+    inline constexpr category_min_level category_min_levels[] = {LOGGER_CATEGORY_MIN_LEVELS};
 #endif
 
-/**
- * @brief Log an info message with custom category (lazy evaluation)
- * @param category The log category string
- * @param ... Variable arguments for message formatting
- */
-#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_INFO
-#define LOG_CAT_INFO(category, ...) \
-    (::failsafe::logger::get_config().min_level.load() > LOGGER_LEVEL_INFO) ? void() : \
-    (::failsafe::logger::log_with_level<LOGGER_LEVEL_INFO>(category, __FILE__, __LINE__, __VA_ARGS__), void())
-#else
-#define LOG_CAT_INFO(category, ...) ((void)0)
+    /**
+     * @brief Compile-time minimum level of a category
+     *
+     * @param category Category name
+     * @return The level from LOGGER_CATEGORY_MIN_LEVELS, or LOGGER_MIN_LEVEL
+     *         if the category is not listed
+     */
+    constexpr int category_compile_time_min_level([[maybe_unused]] std::string_view category) {
+#if LOGGER_HAS_CATEGORY_MIN_LEVELS
+        for (const auto& entry : category_min_levels) {
+            if (entry.category == category) {
+                return entry.level;
+            }
+        }
 #endif
+        return LOGGER_MIN_LEVEL;
+    }
 
-/**
- * @brief Log a warning message with custom category (lazy evaluation)
- * @param category The log category string
- * @param ... Variable arguments for message formatting
- */
-#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_WARN
-#define LOG_CAT_WARN(category, ...) \
-    (::failsafe::logger::get_config().min_level.load() > LOGGER_LEVEL_WARN) ? void() : \
-    (::failsafe::logger::log_with_level<LOGGER_LEVEL_WARN>(category, __FILE__, __LINE__, __VA_ARGS__), void())
-#else
-#define LOG_CAT_WARN(category, ...) ((void)0)
-#endif
+    /**
+     * @brief Whether LOG_CAT_* calls of a level and category are compiled in
+     */
+    constexpr bool is_category_level_compiled_in(int level, std::string_view category) {
+        return level >= category_compile_time_min_level(category);
+    }
 
-/**
- * @brief Log an error message with custom category (lazy evaluation)
- * @param category The log category string
- * @param ... Variable arguments for message formatting
- */
-#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_ERROR
-#define LOG_CAT_ERROR(category, ...) \
-    (::failsafe::logger::get_config().min_level.load() > LOGGER_LEVEL_ERROR) ? void() : \
-    (::failsafe::logger::log_with_level<LOGGER_LEVEL_ERROR>(category, __FILE__, __LINE__, __VA_ARGS__), void())
-#else
-#define LOG_CAT_ERROR(category, ...) ((void)0)
-#endif
+#if FAILSAFE_HAS_FORMAT_STRING
+    /**
+     * @brief Log with specified level using a compile-time checked format string
+     *
+     * The format string is validated against the argument types at compile
+     * time, see format_string.hh. Arguments are not joined with spaces.
+     *
+     * @tparam Level The log level (must be a compile-time constant)
+     * @tparam Args Types of the format arguments
+     * @param category Log category string
+     * @param file Source file name
+     * @param line Source line number
+     * @param fmt Format string with one placeholder per argument
+     * @param args Format arguments
+     */
+    template<int Level, typename... Args>
+    FAILSAFE_COLD FAILSAFE_NOINLINE void log_format_with_level(const char* category, const char* file, int line,
+                                      failsafe::detail::format_string<Args...> fmt, Args&&... args) {
+        if (!is_level_enabled(Level)) {
+            return;
+        }
 
-/**
- * @brief Log a fatal error message with custom category (lazy evaluation)
- * @param category The log category string
- * @param ... Variable arguments for message formatting
- */
-#if LOGGER_MIN_LEVEL <= LOGGER_LEVEL_FATAL
-#define LOG_CAT_FATAL(category, ...) \
-    (::failsafe::logger::get_config().min_level.load() > LOGGER_LEVEL_FATAL) ? void() : \
-    (::failsafe::logger::log_with_level<LOGGER_LEVEL_FATAL>(category, __FILE__, __LINE__, __VA_ARGS__), void())
-#else
-#define LOG_CAT_FATAL(category, ...) ((void)0)
+        std::string message = failsafe::detail::format_message<Args...>(fmt, std::forward <Args>(args)...);
+        internal::dispatch_message(Level, category, file, line, message);
+    }
 #endif
 
-/** @} */ // end of CategoryLogMacros group
-
-namespace failsafe::logger {
     /**
      * @brief Runtime logging function
      * 
@@ -542,65 +414,6 @@ namespace failsafe::logger {
     }
 }
 
-/**
- * @defgroup ConditionalLogMacros Conditional Logging Macros
- * @{
- */
-
-/**
- * @brief Log a message only if condition is true
- * 
- * @param condition Boolean condition to check
- * @param level Log level (runtime value)
- * @param ... Message arguments
- * 
- * @example
- * @code
- * LOG_IF(verbose_mode, LOGGER_LEVEL_DEBUG, "Detailed info:", data);
- * @endcode
- */
-#define LOG_IF(condition, level, ...) \
-    do { \
-        if (condition) { \
-            ::failsafe::logger::log(level, LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__); \
-        } \
-    } while(0)
-
-/**
- * @brief Log a message with category only if condition is true
- * 
- * @param condition Boolean condition to check
- * @param level Log level (runtime value)
- * @param category Log category string
- * @param ... Message arguments
- */
-#define LOG_CAT_IF(condition, level, category, ...) \
-    do { \
-        if (condition) { \
-            ::failsafe::logger::log(level, category, __FILE__, __LINE__, __VA_ARGS__); \
-        } \
-    } while(0)
-
-/**
- * @brief Log with runtime-determined level
- * 
- * Use when log level is not a compile-time constant.
- * 
- * @param level Log level (runtime value)
- * @param ... Message arguments
- */
-#define LOG_RUNTIME(level, ...) \
-    ::failsafe::logger::log(level, LOGGER_DEFAULT_CATEGORY_STR, __FILE__, __LINE__, __VA_ARGS__)
-
-/**
- * @brief Log with runtime-determined level and category
- * 
- * @param level Log level (runtime value)
- * @param category Log category string
- * @param ... Message arguments
- */
-#define LOG_CAT_RUNTIME(level, category, ...) \
-    ::failsafe::logger::log(level, category, __FILE__, __LINE__, __VA_ARGS__)
-
-/** @} */ // end of ConditionalLogMacros group
-
+#ifdef FAILSAFE_HEADER_ONLY
+#include <failsafe/logger-inl.hh>
+#endif
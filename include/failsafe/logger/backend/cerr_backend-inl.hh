@@ -0,0 +1,100 @@
+/**
+ * @file cerr_backend-inl.hh
+ * @brief Definitions of the cerr_backend.hh functions
+ *
+ * @note Included by cerr_backend.hh in header-only mode and compiled into
+ *       failsafe_impl otherwise, see detail/export.hh.
+ */
+#pragma once
+
+#include <failsafe/logger/backend/cerr_backend.hh>
+
+#if defined(_MSC_VER)
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#define FAILSAFE_UNDEF_NOMINMAX
+#endif
+#endif
+
+#include <termcolor/termcolor.hpp>
+
+namespace failsafe::logger::backends {
+
+    FAILSAFE_INLINE void CerrBackend::operator()(int level, const char* category,
+                                               const char* file, int line,
+                                               const std::string& message) {
+        std::lock_guard <std::mutex> lock(mutex_);
+
+        // Add local timestamp, the date part is cached per second
+        if (show_timestamp_) {
+            char stamp[::failsafe::detail::timestamp_max_length + 1];
+            std::size_t used = ::failsafe::detail::format_timestamp(
+                stamp, std::chrono::system_clock::now(), ::failsafe::detail::timestamp_zone::local, ' ');
+            stamp[used++] = ' ';
+            std::cerr.write(stamp, static_cast<std::streamsize>(used));
+        }
+
+        // Add thread ID in brackets
+        if (show_thread_id_) {
+            std::cerr << "[" << std::this_thread::get_id() << "] ";
+        }
+
+        // Apply ANSI color codes based on log level
+        if (use_colors_) {
+            switch (level) {
+                case LOGGER_LEVEL_TRACE: std::cerr << termcolor::white;
+                    break; // White
+                case LOGGER_LEVEL_DEBUG: std::cerr << termcolor::cyan;
+                    break; // Cyan
+                case LOGGER_LEVEL_INFO: std::cerr << termcolor::green;
+                    break; // Green
+                case LOGGER_LEVEL_WARN: std::cerr << termcolor::yellow;
+                    break; // Yellow
+                case LOGGER_LEVEL_ERROR: std::cerr << termcolor::red;
+                    break; // Red
+                default: std::cerr << termcolor::magenta;
+                    break; // Magenta
+            }
+        }
+
+        // Log level and category
+        std::cerr << "[" << logger::internal::level_to_string(level) << "] "
+            << "[" << category << "] ";
+
+        // Reset color
+        if (use_colors_) {
+            std::cerr << termcolor::reset;
+        }
+
+        // Location and message
+        std::cerr << ::failsafe::detail::format_location(file, line)
+            << " - " << message << std::endl;
+    }
+
+    FAILSAFE_INLINE logger::LoggerBackend make_cerr_backend(bool show_timestamp,
+                                                            bool show_thread_id,
+                                                            bool use_colors) {
+        // Use shared_ptr to handle the non-copyable mutex in CerrBackend
+        auto backend = std::make_shared <CerrBackend>(show_timestamp, show_thread_id, use_colors);
+        return [backend](int level, const char* category, const char* file, int line,
+                         const std::string& message) {
+            (*backend)(level, category, file, line, message);
+        };
+    }
+
+    FAILSAFE_INLINE void simple_cerr_backend(int level, const char* category,
+                                             const char* file, int line,
+                                             const std::string& message) {
+        std::cerr << "[" << logger::internal::level_to_string(level) << "] "
+            << "[" << category << "] "
+            << ::failsafe::detail::format_location(file, line) << " - "
+            << message << std::endl;
+    }
+
+} // namespace failsafe::logger::backends
+
+#if defined(FAILSAFE_UNDEF_NOMINMAX)
+#if defined(NOMINMAX)
+#undef NOMINMAX
+#endif
+#endif
@@ -6,7 +6,7 @@
  * Provides a configurable backend that outputs log messages to std::cerr.
  * Features include:
  * - Thread-safe output with mutex protection
- * - Optional timestamp with millisecond precision
+ * - Optional timestamp with FAILSAFE_TIMESTAMP_PRECISION fractional digits
  * - Optional thread ID display
  * - Optional ANSI color codes for different log levels
  * - Customizable formatting
@@ -14,44 +14,23 @@
 #pragma once
 
 #include <failsafe/logger.hh>
+#include <failsafe/detail/export.hh>
 #include <failsafe/detail/location_format.hh>
+#include <failsafe/detail/timestamp_format.hh>
 
 #include <iostream>
 #include <mutex>
 #include <chrono>
-#include <ctime>
-#include <iomanip>
 #include <thread>
 #include <memory>
 #include <sstream>
 
-#if defined(_MSC_VER)
-#if !defined(NOMINMAX)
-#define NOMINMAX
-#define FAILSAFE_UNDEF_NOMINMAX
-#endif
-#endif
-
-#include <termcolor/termcolor.hpp>
-
 /**
  * @namespace failsafe::logger::backends
  * @brief Logger backend implementations
  */
 namespace failsafe::logger::backends {
 
-    namespace detail {
-        /**
-         * @brief Thread-safe wrapper for localtime
-         */
-        inline std::tm* safe_localtime(const std::time_t* time, std::tm* result) {
-#ifdef _WIN32
-            return localtime_s(result, time) == 0 ? result : nullptr;
-#else
-            return localtime_r(time, result);
-#endif
-        }
-    } // namespace detail
     /**
      * @brief Thread-safe stderr backend with configurable output features
      *
@@ -62,7 +41,7 @@ namespace failsafe::logger::backends {
      *
      * Features:
      * - Thread-safe output using mutex protection
-     * - Optional millisecond-precision timestamps
+     * - Optional local timestamps (FAILSAFE_TIMESTAMP_PRECISION digits)
      * - Optional thread ID display
      * - Optional ANSI color codes for log levels
      * - Automatic formatting with location information
@@ -79,7 +58,7 @@ namespace failsafe::logger::backends {
      * logger::set_backend(make_cerr_backend(true, false, true));
      * @endcode
      */
-    class CerrBackend {
+    class FAILSAFE_API CerrBackend {
         private:
             mutable std::mutex mutex_; ///< Mutex for thread-safe output
             bool show_timestamp_; ///< Whether to show timestamps
@@ -116,58 +95,7 @@ namespace failsafe::logger::backends {
              */
             void operator()(int level, const char* category,
                             const char* file, int line,
-                            const std::string& message) {
-                std::lock_guard <std::mutex> lock(mutex_);
-
-                // Add timestamp with millisecond precision
-                if (show_timestamp_) {
-                    auto now = std::chrono::system_clock::now();
-                    auto time_t = std::chrono::system_clock::to_time_t(now);
-                    auto ms = std::chrono::duration_cast <std::chrono::milliseconds>(
-                                  now.time_since_epoch()) % 1000;
-
-                    std::tm tm{};
-                    detail::safe_localtime(&time_t, &tm);
-                    std::cerr << std::put_time(&tm, "%Y-%m-%d %H:%M:%S");
-                    std::cerr << '.' << std::setfill('0') << std::setw(3) << ms.count() << " ";
-                }
-
-                // Add thread ID in brackets
-                if (show_thread_id_) {
-                    std::cerr << "[" << std::this_thread::get_id() << "] ";
-                }
-
-                // Apply ANSI color codes based on log level
-                if (use_colors_) {
-                    switch (level) {
-                        case LOGGER_LEVEL_TRACE: std::cerr << termcolor::white;
-                            break; // White
-                        case LOGGER_LEVEL_DEBUG: std::cerr << termcolor::cyan;
-                            break; // Cyan
-                        case LOGGER_LEVEL_INFO: std::cerr << termcolor::green;
-                            break; // Green
-                        case LOGGER_LEVEL_WARN: std::cerr << termcolor::yellow;
-                            break; // Yellow
-                        case LOGGER_LEVEL_ERROR: std::cerr << termcolor::red;
-                            break; // Red
-                        default: std::cerr << termcolor::magenta;
-                            break; // Magenta
-                    }
-                }
-
-                // Log level and category
-                std::cerr << "[" << logger::internal::level_to_string(level) << "] "
-                    << "[" << category << "] ";
-
-                // Reset color
-                if (use_colors_) {
-                    std::cerr << termcolor::reset;
-                }
-
-                // Location and message
-                std::cerr << ::failsafe::detail::format_location(file, line)
-                    << " - " << message << std::endl;
-            }
+                            const std::string& message);
     };
 
     /**
@@ -187,16 +115,9 @@ namespace failsafe::logger::backends {
      * logger::set_backend(make_cerr_backend(true, true, false));
      * @endcode
      */
-    inline logger::LoggerBackend make_cerr_backend(bool show_timestamp = true,
-                                                   bool show_thread_id = false,
-                                                   bool use_colors = true) {
-        // Use shared_ptr to handle the non-copyable mutex in CerrBackend
-        auto backend = std::make_shared <CerrBackend>(show_timestamp, show_thread_id, use_colors);
-        return [backend](int level, const char* category, const char* file, int line,
-                         const std::string& message) {
-            (*backend)(level, category, file, line, message);
-        };
-    }
+    FAILSAFE_API logger::LoggerBackend make_cerr_backend(bool show_timestamp = true,
+                                                         bool show_thread_id = false,
+                                                         bool use_colors = true);
 
     /**
      * @brief Simple stateless cerr backend function
@@ -217,18 +138,11 @@ namespace failsafe::logger::backends {
      * logger::set_backend(simple_cerr_backend);
      * @endcode
      */
-    inline void simple_cerr_backend(int level, const char* category,
-                                    const char* file, int line,
-                                    const std::string& message) {
-        std::cerr << "[" << logger::internal::level_to_string(level) << "] "
-            << "[" << category << "] "
-            << ::failsafe::detail::format_location(file, line) << " - "
-            << message << std::endl;
-    }
+    FAILSAFE_API void simple_cerr_backend(int level, const char* category,
+                                          const char* file, int line,
+                                          const std::string& message);
 }
 
-#if defined(FAILSAFE_UNDEF_NOMINMAX)
-#if defined(NOMINMAX)
-#undef NOMINMAX
+#ifdef FAILSAFE_HEADER_ONLY
+#include <failsafe/logger/backend/cerr_backend-inl.hh>
 #endif
-#endif
\ No newline at end of file
@@ -0,0 +1,31 @@
+/**
+ * @file macros.hh
+ * @brief Failsafe macros for translation units that import the failsafe module
+ *
+ * @details
+ * A named module cannot export macros. Include this header together with
+ * `import failsafe;` to use the LOG_*, THROW*, TRAP*, ENFORCE* and
+ * error propagation macros;
+ * it contains only preprocessor definitions and a few standard headers.
+ *
+ * @code
+ * #define LOGGER_MIN_LEVEL LOGGER_LEVEL_INFO  // optional, as with logger.hh
+ * #include <failsafe/macros.hh>
+ * import failsafe;
+ *
+ * LOG_INFO("Started with", workers, "workers");
+ * @endcode
+ *
+ * LOGGER_MIN_LEVEL, LOGGER_DEFAULT_CATEGORY and FAILSAFE_DEFAULT_EXCEPTION
+ * are applied where the macros expand. Options evaluated by the library's
+ * own code (LOGGER_CATEGORY_MIN_LEVELS, FAILSAFE_TRAP_MODE, the format
+ * engine and location styles) are those the module was built with.
+ *
+ * Not needed, but harmless, when the regular headers are included.
+ */
+#pragma once
+
+#include <failsafe/detail/logger_macros.hh>
+#include <failsafe/detail/exception_macros.hh>
+#include <failsafe/detail/enforce_macros.hh>
+#include <failsafe/detail/result_macros.hh>
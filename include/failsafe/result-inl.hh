@@ -0,0 +1,27 @@
+/**
+ * @file result-inl.hh
+ * @brief Definitions of the non-template result.hh functions
+ *
+ * @note Included by result.hh in header-only mode and compiled into
+ *       failsafe_impl otherwise, see detail/export.hh.
+ */
+#pragma once
+
+#include <failsafe/result.hh>
+
+#include <failsafe/detail/location_format.hh>
+
+namespace failsafe {
+
+    FAILSAFE_INLINE std::string error::message() const {
+        if (!message_.empty()) {
+            return message_.str();
+        }
+        return detail::build_message("Enforcement failed: ", site_->expression, " - ", description_);
+    }
+
+    FAILSAFE_INLINE std::string error::to_string() const {
+        return detail::format_location_with_separator(site_->file, site_->line) + message();
+    }
+
+} // namespace failsafe
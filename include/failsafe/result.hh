@@ -0,0 +1,373 @@
+/**
+ * @file result.hh
+ * @brief Error records and results for code that does not throw
+ *
+ * @details
+ * failsafe::result<T> holds either a value or a failsafe::error. It is
+ * returned by the ENFORCE_RESULT* macros (enforce.hh), which check the same
+ * predicates as ENFORCE but report a failure to the caller instead of
+ * raising it, and it is usable with -fno-exceptions.
+ *
+ * A failsafe::error is a compact record:
+ * - the address of a per call site constant (failsafe::error_site) with the
+ *   file, line, checked expression and a site id
+ * - the description of the failed predicate
+ * - the custom message arguments, copied but not formatted
+ *
+ * Creating an error with the default message allocates nothing; the message
+ * is only built when message() is called.
+ *
+ * @example
+ * @code
+ * failsafe::result<session*> find_session(std::uint64_t id) {
+ *     return ENFORCE_RESULT(sessions.lookup(id))("No session for id", id);
+ * }
+ *
+ * failsafe::result<void> handle(const request& req) {
+ *     ASSIGN_OR_PROPAGATE(session* s, find_session(req.session_id));
+ *     PROPAGATE_ERROR(ENFORCE_RESULT_LT(req.size, s->max_request_size));
+ *     ...
+ *     return {};
+ * }
+ *
+ * if (auto r = handle(req); !r) {
+ *     LOG_WARN("Request rejected:", r.error().to_string());
+ * }
+ * @endcode
+ */
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include <failsafe/exception.hh>
+#include <failsafe/detail/attributes.hh>
+#include <failsafe/detail/export.hh>
+#include <failsafe/detail/captured_args.hh>
+#include <failsafe/detail/result_macros.hh>
+
+namespace failsafe {
+
+    /**
+     * @brief Identity of a source location that reports errors
+     *
+     * Created once per call site by FAILSAFE_ERROR_SITE.
+     */
+    struct error_site {
+        const char* file; ///< Source file name
+        int line; ///< Source line number
+        const char* expression; ///< The checked expression (empty for STATUS_ERROR)
+        std::uint32_t id; ///< Hash of file and line, stable across runs
+    };
+
+    namespace detail {
+        /**
+         * @brief FNV-1a hash of a file name and line number
+         *
+         * Identifies a call site in logs and metrics independently of where
+         * the program is loaded.
+         */
+        constexpr std::uint32_t site_id(const char* file, int line) noexcept {
+            std::uint32_t hash = 2166136261u;
+            for (; *file != '\0'; ++file) {
+                hash = (hash ^ static_cast<unsigned char>(*file)) * 16777619u;
+            }
+            auto value = static_cast<std::uint32_t>(line);
+            for (int i = 0; i < 4; ++i) {
+                hash = (hash ^ (value & 0xffu)) * 16777619u;
+                value >>= 8;
+            }
+            return hash;
+        }
+    } // namespace detail
+
+    /**
+     * @brief A failed check, reported without an exception
+     *
+     * Copies share the captured message arguments.
+     */
+    class FAILSAFE_API error {
+        public:
+            /**
+             * @brief Error with the default enforcement message
+             *
+             * @param site The failing call site
+             * @param description Description of the failed predicate
+             *        (must have static storage duration)
+             */
+            error(const error_site& site, const char* description) noexcept
+                : site_(&site), description_(description) {
+            }
+
+            /**
+             * @brief Error with a custom message
+             *
+             * @param site The failing call site
+             * @param description Description of the failed predicate
+             * @param message Captured message arguments
+             */
+            error(const error_site& site, const char* description, detail::captured_args message) noexcept
+                : site_(&site), description_(description), message_(std::move(message)) {
+            }
+
+            /** @brief The failing call site */
+            const error_site& site() const noexcept {
+                return *site_;
+            }
+
+            /** @brief Source file of the failing call site */
+            const char* file() const noexcept {
+                return site_->file;
+            }
+
+            /** @brief Source line of the failing call site */
+            int line() const noexcept {
+                return site_->line;
+            }
+
+            /** @brief Description of the failed predicate */
+            const char* description() const noexcept {
+                return description_;
+            }
+
+            /** @brief Whether a custom message was given */
+            bool has_custom_message() const noexcept {
+                return !message_.empty();
+            }
+
+            /**
+             * @brief The message, built on each call
+             *
+             * The custom message if one was given, otherwise the default
+             * message of ENFORCE: "Enforcement failed: <expression> - <description>".
+             */
+            std::string message() const;
+
+            /**
+             * @brief Location and message, as in the what() text of an
+             *        exception thrown by ENFORCE
+             */
+            std::string to_string() const;
+
+            /**
+             * @brief Replace the message with captured arguments
+             */
+            void set_message(detail::captured_args message) noexcept {
+                message_ = std::move(message);
+            }
+
+        private:
+            const error_site* site_;
+            const char* description_;
+            detail::captured_args message_;
+    };
+
+    namespace detail {
+        /**
+         * @brief Access to the value of a result holding an error
+         *
+         * Throws FAILSAFE_DEFAULT_EXCEPTION with the error's message; with
+         * exceptions disabled, prints it and terminates.
+         * @internal
+         */
+        [[noreturn]] FAILSAFE_NOINLINE FAILSAFE_COLD
+        inline void bad_result_access(const error& e) {
+            exception::internal::raise_site_scope raised_for(FAILSAFE_RETURN_ADDRESS());
+            exception::internal::throw_exception<FAILSAFE_DEFAULT_EXCEPTION>(e.file(), e.line(), e.message());
+        }
+    } // namespace detail
+
+    /**
+     * @brief A value or the error that prevented it
+     *
+     * value() checks and reports an access to a failed result like a failed
+     * ENFORCE; operator* and operator-> do not check.
+     *
+     * @tparam T The value type (an object type)
+     */
+    template<typename T>
+    class [[nodiscard]] result {
+        static_assert(std::is_object_v<T> && !std::is_same_v<std::remove_cv_t<T>, failsafe::error>,
+                      "failsafe::result holds an object other than failsafe::error");
+
+        public:
+            using value_type = T;
+
+            /** @brief Successful result */
+            result(const T& value)
+                : storage_(std::in_place_index<0>, value) {
+            }
+
+            /** @brief Successful result, moving the value in */
+            result(T&& value)
+                : storage_(std::in_place_index<0>, std::move(value)) {
+            }
+
+            /** @brief Failed result */
+            result(failsafe::error e) noexcept
+                : storage_(std::in_place_index<1>, std::move(e)) {
+            }
+
+            /** @brief Whether the result holds a value */
+            bool has_value() const noexcept {
+                return storage_.index() == 0;
+            }
+
+            /** @copydoc has_value() */
+            explicit operator bool() const noexcept {
+                return has_value();
+            }
+
+            /** @brief The value; reports an error result */
+            T& value() & {
+                check();
+                return *std::get_if<0>(&storage_);
+            }
+
+            /** @copydoc value() */
+            const T& value() const& {
+                check();
+                return *std::get_if<0>(&storage_);
+            }
+
+            /** @copydoc value() */
+            T&& value() && {
+                check();
+                return std::move(*std::get_if<0>(&storage_));
+            }
+
+            /** @brief The value, or fallback for an error result */
+            template<typename U>
+            T value_or(U&& fallback) const& {
+                return has_value() ? *std::get_if<0>(&storage_) : static_cast<T>(std::forward<U>(fallback));
+            }
+
+            /** @copydoc value_or() */
+            template<typename U>
+            T value_or(U&& fallback) && {
+                return has_value() ? std::move(*std::get_if<0>(&storage_)) : static_cast<T>(std::forward<U>(fallback));
+            }
+
+            /** @brief The value, unchecked */
+            T& operator*() & noexcept {
+                return *std::get_if<0>(&storage_);
+            }
+
+            /** @copydoc operator*() */
+            const T& operator*() const& noexcept {
+                return *std::get_if<0>(&storage_);
+            }
+
+            /** @copydoc operator*() */
+            T&& operator*() && noexcept {
+                return std::move(*std::get_if<0>(&storage_));
+            }
+
+            /** @brief Member access to the value, unchecked */
+            T* operator->() noexcept {
+                return std::get_if<0>(&storage_);
+            }
+
+            /** @copydoc operator->() */
+            const T* operator->() const noexcept {
+                return std::get_if<0>(&storage_);
+            }
+
+            /** @brief The error; only valid if has_value() is false */
+            const failsafe::error& error() const noexcept {
+                return *std::get_if<1>(&storage_);
+            }
+
+            /**
+             * @brief Give a failed result a custom message
+             *
+             * The arguments are copied for a failed result, and formatted
+             * only by error().message(); a successful result ignores them.
+             * Chained onto ENFORCE_RESULT* like the custom message of ENFORCE.
+             *
+             * @return This result, moved (so that binding the returned
+             *         value to a reference extends its lifetime)
+             */
+            template<typename... Args>
+            result operator()(Args&&... args) && {
+                if (FAILSAFE_UNLIKELY(!has_value())) {
+                    std::get_if<1>(&storage_)->set_message(
+                        detail::captured_args::capture(std::forward<Args>(args)...));
+                }
+                return std::move(*this);
+            }
+
+        private:
+            FAILSAFE_ALWAYS_INLINE void check() const {
+                if (FAILSAFE_UNLIKELY(!has_value())) {
+                    detail::bad_result_access(*std::get_if<1>(&storage_));
+                }
+            }
+
+            std::variant<T, failsafe::error> storage_;
+    };
+
+    /**
+     * @brief Success or the error of an operation without a value
+     */
+    template<>
+    class [[nodiscard]] result<void> {
+        public:
+            using value_type = void;
+
+            /** @brief Successful result */
+            result() noexcept = default;
+
+            /** @brief Failed result */
+            result(failsafe::error e) noexcept
+                : error_(std::move(e)) {
+            }
+
+            /** @brief Whether the operation succeeded */
+            bool has_value() const noexcept {
+                return !error_.has_value();
+            }
+
+            /** @copydoc has_value() */
+            explicit operator bool() const noexcept {
+                return has_value();
+            }
+
+            /** @brief Reports an error result like value() of result<T> */
+            FAILSAFE_ALWAYS_INLINE void value() const {
+                if (FAILSAFE_UNLIKELY(error_.has_value())) {
+                    detail::bad_result_access(*error_);
+                }
+            }
+
+            /** @brief Does nothing; for ASSIGN_OR_PROPAGATE-like generic code */
+            void operator*() const noexcept {
+            }
+
+            /** @brief The error; only valid if has_value() is false */
+            const failsafe::error& error() const noexcept {
+                return *error_;
+            }
+
+            /** @copydoc result::operator()() */
+            template<typename... Args>
+            result operator()(Args&&... args) && {
+                if (FAILSAFE_UNLIKELY(error_.has_value())) {
+                    error_->set_message(detail::captured_args::capture(std::forward<Args>(args)...));
+                }
+                return std::move(*this);
+            }
+
+        private:
+            std::optional<failsafe::error> error_;
+    };
+
+} // namespace failsafe
+
+#ifdef FAILSAFE_HEADER_ONLY
+#include <failsafe/result-inl.hh>
+#endif
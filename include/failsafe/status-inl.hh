@@ -0,0 +1,34 @@
+/**
+ * @file status-inl.hh
+ * @brief Definitions of the non-template status.hh functions
+ *
+ * @note Included by status.hh in header-only mode and compiled into
+ *       failsafe_impl otherwise, see detail/export.hh.
+ */
+#pragma once
+
+#include <failsafe/status.hh>
+
+#include <failsafe/detail/location_format.hh>
+
+namespace failsafe {
+
+    FAILSAFE_INLINE std::string status::message() const {
+        if (!state_) {
+            return {};
+        }
+        std::string code_text = std::string(state_->code.category().name()) + ": " + state_->code.message();
+        if (state_->message.empty()) {
+            return code_text;
+        }
+        return state_->message.str() + " (" + code_text + ")";
+    }
+
+    FAILSAFE_INLINE std::string status::to_string() const {
+        if (!state_) {
+            return {};
+        }
+        return detail::format_location_with_separator(state_->site->file, state_->site->line) + message();
+    }
+
+} // namespace failsafe
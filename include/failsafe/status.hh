@@ -0,0 +1,202 @@
+/**
+ * @file status.hh
+ * @brief Error codes with location and message, returned instead of thrown
+ *
+ * @details
+ * failsafe::status reports routine failures (timeouts, missing entries)
+ * without unwinding. It is one pointer: null for success, so creating,
+ * returning and moving a successful status costs as much as an int. A
+ * failure allocates one record with
+ * - the error code (a std::error_code: category and value)
+ * - the call site (failsafe::error_site: file, line and site id)
+ * - the message arguments, copied but only formatted by message()
+ *
+ * At API boundaries, throw_if_error() converts a failure into an exception
+ * of the configured type, with the same location and message formatting as
+ * THROW.
+ *
+ * @example
+ * @code
+ * failsafe::status fetch(const request& req, reply& out) {
+ *     if (!channel.wait(req.deadline)) {
+ *         return STATUS_ERROR(std::errc::timed_out, "No reply from", req.peer, "within", req.timeout);
+ *     }
+ *     PROPAGATE_STATUS(decode(channel.read(), out));
+ *     return {};
+ * }
+ *
+ * // Internal callers branch on the code
+ * if (auto s = fetch(req, out); s.code() == std::errc::timed_out) { retry(req); }
+ *
+ * // Public API: throw FAILSAFE_DEFAULT_EXCEPTION
+ * fetch(req, out).throw_if_error();
+ * @endcode
+ */
+#pragma once
+
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <failsafe/exception.hh>
+#include <failsafe/result.hh>
+#include <failsafe/detail/attributes.hh>
+#include <failsafe/detail/export.hh>
+#include <failsafe/detail/captured_args.hh>
+#include <failsafe/detail/result_macros.hh>
+
+namespace failsafe {
+
+    /**
+     * @brief Success, or an error code with location and message
+     */
+    class [[nodiscard]] FAILSAFE_API status {
+        public:
+            /** @brief Success */
+            status() noexcept = default;
+
+            /**
+             * @brief Failure
+             *
+             * @param code The error code; should not be zero
+             * @param site The reporting call site, from FAILSAFE_ERROR_SITE
+             * @param message Captured message arguments (may be empty)
+             */
+            status(std::error_code code, const error_site& site, detail::captured_args message = {})
+                : state_(std::make_unique<state>(state{code, &site, std::move(message)})) {
+            }
+
+            /** @brief Copies the failure record, if any */
+            status(const status& other)
+                : state_(other.state_ ? std::make_unique<state>(*other.state_) : nullptr) {
+            }
+
+            status(status&&) noexcept = default;
+
+            /** @brief Copies the failure record, if any */
+            status& operator=(const status& other) {
+                if (this != &other) {
+                    state_ = other.state_ ? std::make_unique<state>(*other.state_) : nullptr;
+                }
+                return *this;
+            }
+
+            status& operator=(status&&) noexcept = default;
+
+            /** @brief Whether this is a success */
+            bool ok() const noexcept {
+                return !state_;
+            }
+
+            /** @copydoc ok() */
+            explicit operator bool() const noexcept {
+                return ok();
+            }
+
+            /** @brief The error code; zero for success */
+            std::error_code code() const noexcept {
+                return state_ ? state_->code : std::error_code{};
+            }
+
+            /** @brief The reporting call site; null for success */
+            const error_site* site() const noexcept {
+                return state_ ? state_->site : nullptr;
+            }
+
+            /**
+             * @brief The message, built on each call
+             *
+             * The custom message followed by the code's message, e.g.
+             * "No reply from node-3 within 250ms (generic: Connection timed out)";
+             * empty for success.
+             */
+            std::string message() const;
+
+            /**
+             * @brief Location and message, as in the what() text of an
+             *        exception thrown by throw_if_error()
+             */
+            std::string to_string() const;
+
+            /**
+             * @brief Throw a failure as an exception
+             *
+             * Does nothing for success. Otherwise throws Exception like THROW
+             * from the reporting call site would, with message() as its
+             * message; with exceptions disabled, prints it and terminates.
+             *
+             * @tparam Exception The exception type (default:
+             *         FAILSAFE_DEFAULT_EXCEPTION)
+             */
+            template<typename Exception = FAILSAFE_DEFAULT_EXCEPTION>
+            FAILSAFE_ALWAYS_INLINE void throw_if_error() const {
+                if (FAILSAFE_UNLIKELY(state_ != nullptr)) {
+                    throw_status<Exception>(*this);
+                }
+            }
+
+        private:
+            struct state {
+                std::error_code code;
+                const error_site* site;
+                detail::captured_args message;
+            };
+
+            template<typename Exception>
+            [[noreturn]] FAILSAFE_NOINLINE FAILSAFE_COLD
+            static void throw_status(const status& s) {
+                exception::internal::raise_site_scope raised_for(FAILSAFE_RETURN_ADDRESS());
+                exception::internal::throw_exception<Exception>(s.state_->site->file, s.state_->site->line,
+                                                                s.message());
+            }
+
+            std::unique_ptr<state> state_;
+    };
+
+    namespace detail {
+        /**
+         * @brief Convert an error code enumerator (or std::error_code)
+         *
+         * Uses make_error_code(), found by argument-dependent lookup, for
+         * enumerations registered as error codes or conditions (such as
+         * std::errc).
+         * @internal
+         */
+        template<typename Code>
+        std::error_code to_error_code(Code code) {
+            if constexpr (std::is_same_v<Code, std::error_code>) {
+                return code;
+            } else {
+                static_assert(std::is_error_code_enum_v<Code> || std::is_error_condition_enum_v<Code>,
+                              "STATUS_ERROR needs a std::error_code or an error code enumeration");
+                using std::make_error_code;
+                return make_error_code(code);
+            }
+        }
+
+        /**
+         * @brief Call site of STATUS_ERROR; erases the message arguments
+         *
+         * A function object so that STATUS_ERROR also works without message
+         * arguments. Out of line and cold: the caller's success path only
+         * stores a null pointer.
+         * @internal
+         */
+        struct status_site {
+            const error_site& site;
+
+            template<typename Code, typename... Args>
+            FAILSAFE_NOINLINE FAILSAFE_COLD
+            status operator()(Code code, Args&&... args) const {
+                return status(to_error_code(code), site, captured_args::capture(std::forward<Args>(args)...));
+            }
+        };
+    } // namespace detail
+
+} // namespace failsafe
+
+#ifdef FAILSAFE_HEADER_ONLY
+#include <failsafe/status-inl.hh>
+#endif
@@ -0,0 +1,146 @@
+/**
+ * @file throw_stats-inl.hh
+ * @brief Definitions of the throw_stats.hh functions
+ *
+ * @note Included by throw_stats.hh in header-only mode and compiled into
+ *       failsafe_impl otherwise, see detail/export.hh.
+ */
+#pragma once
+
+#include <failsafe/throw_stats.hh>
+
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace failsafe::exception {
+
+    namespace internal {
+        /**
+         * @brief The n records with the highest counts, as stats over `seconds`
+         */
+        FAILSAFE_INLINE std::vector <throw_site_stats> top_sites(
+            std::vector <failsafe::detail::throw_site_record>& records, double seconds, std::size_t n) {
+            n = std::min(n, records.size());
+            std::partial_sort(records.begin(), records.begin() + static_cast<std::ptrdiff_t>(n), records.end(),
+                              [](const auto& a, const auto& b) { return a.count > b.count; });
+
+            std::vector <throw_site_stats> sites;
+            sites.reserve(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                const auto& record = records[i];
+                sites.push_back({record.file != nullptr ? record.file : "(other sites)", record.line,
+                                 record.expression, record.count,
+                                 seconds > 0 ? static_cast<double>(record.count) / seconds : 0.0});
+            }
+            return sites;
+        }
+
+        FAILSAFE_INLINE void log_sites(const std::vector <throw_site_stats>& sites, int level) {
+            for (std::size_t i = 0; i < sites.size(); ++i) {
+                const throw_site_stats& site = sites[i];
+                if (*site.expression != '\0') {
+                    failsafe::logger::log(level, "throw_sites", site.file, site.line,
+                                          "Throw site", i + 1, "-", site.count, "exceptions,",
+                                          site.per_second, "per second - enforcing", site.expression);
+                } else {
+                    failsafe::logger::log(level, "throw_sites", site.file, site.line,
+                                          "Throw site", i + 1, "-", site.count, "exceptions,",
+                                          site.per_second, "per second");
+                }
+            }
+        }
+    } // namespace failsafe::exception::internal
+
+    FAILSAFE_INLINE std::vector <throw_site_stats> top_throw_sites(std::size_t n) {
+        double seconds = 0;
+        auto records = failsafe::detail::throw_counts(seconds);
+        return internal::top_sites(records, seconds, n);
+    }
+
+    FAILSAFE_INLINE void reset_throw_counts() noexcept {
+        failsafe::detail::reset_throw_counts();
+    }
+
+    FAILSAFE_INLINE void log_top_throw_sites(std::size_t n, int level) {
+        internal::log_sites(top_throw_sites(n), level);
+    }
+
+    /**
+     * @brief Reporting thread and the counts of its previous report
+     */
+    struct throw_site_reporter::state {
+        std::chrono::milliseconds interval;
+        std::size_t n;
+        int level;
+
+        std::mutex mutex;
+        std::condition_variable wakeup;
+        bool stopping = false;
+
+        std::vector <std::uint64_t> previous = std::vector <std::uint64_t>(failsafe::detail::max_throw_sites + 1);
+        std::chrono::steady_clock::time_point previous_time;
+        std::thread thread;
+
+        /** @brief Counts since the previous report; stores the current ones */
+        std::vector <failsafe::detail::throw_site_record> take_deltas() {
+            double unused = 0;
+            auto records = failsafe::detail::throw_counts(unused);
+            for (auto& record : records) {
+                const std::uint64_t current = record.count;
+                // A reset in between restarts from zero
+                record.count = current >= previous[record.slot] ? current - previous[record.slot] : current;
+                previous[record.slot] = current;
+            }
+            records.erase(std::remove_if(records.begin(), records.end(),
+                                         [](const auto& record) { return record.count == 0; }),
+                          records.end());
+            return records;
+        }
+
+        void report() {
+            auto now = std::chrono::steady_clock::now();
+            const double seconds = std::chrono::duration <double>(now - previous_time).count();
+            previous_time = now;
+            auto records = take_deltas();
+            internal::log_sites(internal::top_sites(records, seconds, n), level);
+        }
+
+        void run() {
+            std::unique_lock <std::mutex> lock(mutex);
+            while (!wakeup.wait_for(lock, interval, [this] { return stopping; })) {
+#if FAILSAFE_HAS_EXCEPTIONS
+                try {
+                    report();
+                } catch (...) {
+                    // A failing backend must not end the process; try again next time
+                }
+#else
+                report();
+#endif
+            }
+        }
+    };
+
+    FAILSAFE_INLINE throw_site_reporter::throw_site_reporter(std::chrono::milliseconds interval, std::size_t n,
+                                                             int level)
+        : state_(std::make_unique <state>()) {
+        state_->interval = interval;
+        state_->n = n;
+        state_->level = level;
+        state_->take_deltas();
+        state_->previous_time = std::chrono::steady_clock::now();
+        state_->thread = std::thread([s = state_.get()] { s->run(); });
+    }
+
+    FAILSAFE_INLINE throw_site_reporter::~throw_site_reporter() {
+        {
+            std::lock_guard <std::mutex> lock(state_->mutex);
+            state_->stopping = true;
+        }
+        state_->wakeup.notify_one();
+        state_->thread.join();
+    }
+
+} // namespace failsafe::exception
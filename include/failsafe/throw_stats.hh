@@ -0,0 +1,113 @@
+/**
+ * @file throw_stats.hh
+ * @brief Reports of the call sites that raise exceptions most often
+ *
+ * @details
+ * failsafe counts every exception raised by THROW and ENFORCE per call site
+ * (see detail/throw_counters.hh). A site that throws thousands of times per
+ * second is usually an exception used for control flow in hot code; these
+ * functions find them:
+ * - top_throw_sites(): the sites with the highest counts, with their rates
+ * - log_top_throw_sites(): the same through the logger, one message per site
+ * - throw_site_reporter: logs the top sites of each interval from a
+ *   background thread
+ *
+ * @example
+ * @code
+ * // In main(): every minute, log the ten sites that threw most in that minute
+ * failsafe::exception::throw_site_reporter reporter(std::chrono::minutes(1), 10);
+ *
+ * // On demand, e.g. from an admin endpoint
+ * for (const auto& site : failsafe::exception::top_throw_sites(5)) {
+ *     std::cout << site.file << ":" << site.line << " " << site.count
+ *               << " (" << site.per_second << "/s)\n";
+ * }
+ * @endcode
+ */
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <failsafe/exception.hh>
+#include <failsafe/logger.hh>
+#include <failsafe/detail/export.hh>
+#include <failsafe/detail/throw_counters.hh>
+
+namespace failsafe::exception {
+
+    /**
+     * @brief Exceptions raised from one call site
+     */
+    struct throw_site_stats {
+        /** @brief Source file; "(other sites)" for the sites beyond the counted maximum */
+        const char* file;
+        int line; ///< Source line
+        const char* expression; ///< Checked expression of an ENFORCE; empty for THROW
+        std::uint64_t count; ///< Exceptions raised since the counts were last reset
+        double per_second; ///< count divided by the time since the last reset
+    };
+
+    /**
+     * @brief The call sites that raised the most exceptions
+     *
+     * @param n Number of sites to return at most
+     * @return Sites in decreasing count order
+     */
+    FAILSAFE_API std::vector <throw_site_stats> top_throw_sites(std::size_t n = 10);
+
+    /**
+     * @brief Zero all throw counts and restart the rate measurement
+     */
+    FAILSAFE_API void reset_throw_counts() noexcept;
+
+    /**
+     * @brief Log the top_throw_sites(), one message per site
+     *
+     * Messages have the category "throw_sites" and the location of the
+     * reported site.
+     *
+     * @param n Number of sites to log at most
+     * @param level Log level (LOGGER_LEVEL_*)
+     */
+    FAILSAFE_API void log_top_throw_sites(std::size_t n = 10, int level = LOGGER_LEVEL_INFO);
+
+    /**
+     * @brief Periodically logs the sites that threw most in the last interval
+     *
+     * Starts a background thread that wakes up once per interval and logs,
+     * like log_top_throw_sites(), the sites with the highest counts since
+     * its previous report, with their rates over the interval. Quiet
+     * intervals log nothing. The thread stops when the reporter is
+     * destroyed.
+     */
+    class FAILSAFE_API throw_site_reporter {
+        public:
+            /**
+             * @param interval Time between two reports
+             * @param n Number of sites to log per report at most
+             * @param level Log level (LOGGER_LEVEL_*)
+             */
+            explicit throw_site_reporter(std::chrono::milliseconds interval, std::size_t n = 10,
+                                         int level = LOGGER_LEVEL_INFO);
+
+            /** @brief Stops the reporting thread, without a final report */
+            ~throw_site_reporter();
+
+            throw_site_reporter(const throw_site_reporter&) = delete;
+            throw_site_reporter& operator=(const throw_site_reporter&) = delete;
+
+        private:
+            struct state;
+
+            std::unique_ptr <state> state_;
+    };
+
+} // namespace failsafe::exception
+
+#ifdef FAILSAFE_HEADER_ONLY
+#include <failsafe/throw_stats-inl.hh>
+#endif
@@ -0,0 +1,24 @@
+/**
+ * @file failsafe.cc
+ * @brief Definitions compiled into the failsafe_impl library
+ *
+ * @details
+ * Built with FAILSAFE_COMPILED_LIB defined (see detail/export.hh), so the
+ * public headers only declare the functions below and this translation unit
+ * provides their single definition.
+ */
+#if !defined(FAILSAFE_COMPILED_LIB)
+#error "src/failsafe.cc must be compiled with FAILSAFE_COMPILED_LIB defined"
+#endif
+
+#include <failsafe/detail/location_format-inl.hh>
+#include <failsafe/detail/format_args-inl.hh>
+#include <failsafe/detail/captured_args-inl.hh>
+#include <failsafe/detail/stack_trace-inl.hh>
+#include <failsafe/detail/throw_counters-inl.hh>
+#include <failsafe/logger-inl.hh>
+#include <failsafe/exception-inl.hh>
+#include <failsafe/result-inl.hh>
+#include <failsafe/status-inl.hh>
+#include <failsafe/throw_stats-inl.hh>
+#include <failsafe/logger/backend/cerr_backend-inl.hh>
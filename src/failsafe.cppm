@@ -0,0 +1,204 @@
+/**
+ * @file failsafe.cppm
+ * @brief C++20 named module `failsafe`
+ *
+ * @details
+ * Exports the failsafe API, together with the internal functions the
+ * macros expand to. Macros cannot be exported by a module; translation
+ * units that use them include <failsafe/macros.hh> next to the import:
+ *
+ * @code
+ * #include <failsafe/macros.hh>
+ * import failsafe;
+ * @endcode
+ *
+ * Built by the failsafe_module CMake target (NEUTRINO_FAILSAFE_BUILD_MODULE).
+ * The headers are parsed once, when the module is built, with that
+ * target's configuration macros.
+ */
+module;
+
+#include <failsafe/failsafe.hh>
+
+export module failsafe;
+
+export namespace failsafe::logger {
+    using failsafe::logger::LoggerBackend;
+    using failsafe::logger::LoggerConfig;
+    using failsafe::logger::get_config;
+    using failsafe::logger::set_backend;
+    using failsafe::logger::reset_backend;
+    using failsafe::logger::set_min_level;
+    using failsafe::logger::set_enabled;
+    using failsafe::logger::is_level_enabled;
+    using failsafe::logger::log;
+    using failsafe::logger::log_with_level;
+#if FAILSAFE_HAS_FORMAT_STRING
+    using failsafe::logger::log_format_with_level;
+#endif
+#if LOGGER_HAS_CATEGORY_MIN_LEVELS
+    using failsafe::logger::category_min_level;
+    using failsafe::logger::category_min_levels;
+#endif
+    using failsafe::logger::category_compile_time_min_level;
+    using failsafe::logger::is_category_level_compiled_in;
+}
+
+export namespace failsafe::logger::internal {
+    using failsafe::logger::internal::level_to_string;
+    using failsafe::logger::internal::runtime_min_level;
+}
+
+export namespace failsafe::logger::backends {
+    using failsafe::logger::backends::CerrBackend;
+    using failsafe::logger::backends::make_cerr_backend;
+    using failsafe::logger::backends::simple_cerr_backend;
+}
+
+export namespace failsafe {
+    using failsafe::error_site;
+    using failsafe::error;
+    using failsafe::result;
+    using failsafe::status;
+}
+
+export namespace failsafe::exception {
+    using failsafe::exception::lazy_error;
+    using failsafe::exception::get_nested_trace;
+    using failsafe::exception::print_exception_trace;
+    using failsafe::exception::stack_capture;
+    using failsafe::exception::set_stack_capture;
+    using failsafe::exception::get_stack_capture;
+    using failsafe::exception::set_chain_recording;
+    using failsafe::exception::get_chain_recording;
+    using failsafe::exception::throw_site_stats;
+    using failsafe::exception::top_throw_sites;
+    using failsafe::exception::reset_throw_counts;
+    using failsafe::exception::log_top_throw_sites;
+    using failsafe::exception::throw_site_reporter;
+}
+
+export namespace failsafe::exception::internal {
+    using failsafe::exception::internal::throw_exception;
+    using failsafe::exception::internal::throw_exception_from_args;
+    using failsafe::exception::internal::trap_from_args;
+    using failsafe::exception::internal::trap_site;
+    using failsafe::exception::internal::print_exception_info;
+#if FAILSAFE_HAS_EXCEPTIONS
+    using failsafe::exception::internal::throw_chained;
+    using failsafe::exception::internal::throw_traced;
+#endif
+    using failsafe::exception::internal::chained_exception;
+    using failsafe::exception::internal::traced_exception;
+    using failsafe::exception::internal::capture_stack;
+    using failsafe::exception::internal::current_raise_site;
+    using failsafe::exception::internal::raise_site_scope;
+    using failsafe::exception::internal::trace_link;
+    using failsafe::exception::internal::trace_node;
+    using failsafe::exception::internal::typed_trace_node;
+    using failsafe::exception::internal::last_throw;
+    using failsafe::exception::internal::last_failsafe_throw;
+}
+
+export namespace failsafe::enforce {
+    using failsafe::enforce::enforcer;
+    using failsafe::enforce::make_enforcer;
+    using failsafe::enforce::make_enforcer_throw;
+    using failsafe::enforce::make_enforcer_trap;
+    using failsafe::enforce::enforce_eq;
+    using failsafe::enforce::enforce_ne;
+    using failsafe::enforce::enforce_lt;
+    using failsafe::enforce::enforce_gt;
+    using failsafe::enforce::enforce_in_range;
+    using failsafe::enforce::enforce_all;
+    using failsafe::enforce::enforce_all_in_range;
+    using failsafe::enforce::enforce_all_valid_index;
+    using failsafe::enforce::enforce_constexpr;
+    using failsafe::enforce::enforce_constexpr_eq;
+    using failsafe::enforce::enforce_constexpr_ne;
+    using failsafe::enforce::enforce_constexpr_lt;
+    using failsafe::enforce::enforce_constexpr_gt;
+    using failsafe::enforce::enforce_constexpr_le;
+    using failsafe::enforce::enforce_constexpr_ge;
+    using failsafe::enforce::enforce_constexpr_in_range;
+    using failsafe::enforce::enforce_result;
+    using failsafe::enforce::enforce_result_eq;
+    using failsafe::enforce::enforce_result_ne;
+    using failsafe::enforce::enforce_result_lt;
+    using failsafe::enforce::enforce_result_gt;
+    using failsafe::enforce::enforce_result_in_range;
+}
+
+export namespace failsafe::enforce::predicates {
+    using failsafe::enforce::predicates::truth;
+    using failsafe::enforce::predicates::equal_to;
+    using failsafe::enforce::predicates::not_equal_to;
+    using failsafe::enforce::predicates::less_than;
+    using failsafe::enforce::predicates::greater_than;
+    using failsafe::enforce::predicates::less_equal;
+    using failsafe::enforce::predicates::greater_equal;
+    using failsafe::enforce::predicates::in_range;
+    using failsafe::enforce::predicates::not_nan;
+    using failsafe::enforce::predicates::valid_index;
+}
+
+export namespace failsafe::enforce::raisers {
+    using failsafe::enforce::raisers::default_raiser;
+    using failsafe::enforce::raisers::exception_raiser;
+    using failsafe::enforce::raisers::trap_raiser;
+}
+
+export namespace failsafe::detail {
+    // Message building and formatters
+    using failsafe::detail::build_message;
+    using failsafe::detail::append_to_stream;
+    using failsafe::detail::uppercase;
+    using failsafe::detail::lowercase;
+    using failsafe::detail::hex;
+    using failsafe::detail::oct;
+    using failsafe::detail::bin;
+    using failsafe::detail::container;
+    using failsafe::detail::hexdump;
+    using failsafe::detail::hexdump_options;
+    using failsafe::detail::uppercase_format;
+    using failsafe::detail::lowercase_format;
+    using failsafe::detail::hex_format;
+    using failsafe::detail::oct_format;
+    using failsafe::detail::bin_format;
+    using failsafe::detail::container_format;
+    using failsafe::detail::hexdump_format;
+#if FAILSAFE_FORMAT_ENGINE != FAILSAFE_FORMAT_ENGINE_IOSTREAM
+    using failsafe::detail::append_to_buffer;
+#endif
+#if FAILSAFE_HAS_FORMAT_STRING
+    using failsafe::detail::basic_format_string;
+    using failsafe::detail::format_string;
+    using failsafe::detail::format_message;
+#endif
+
+    // Source locations
+    using failsafe::detail::extract_filename;
+    using failsafe::detail::format_file_path;
+    using failsafe::detail::format_location;
+    using failsafe::detail::append_location;
+    using failsafe::detail::format_location_with_separator;
+
+    // Used by ENFORCE_VALID_INDEX
+    using failsafe::detail::is_valid_index;
+
+    // Error records
+    using failsafe::detail::captured_args;
+    using failsafe::detail::stack_trace;
+    using failsafe::detail::site_id;
+    using failsafe::detail::status_site;
+    using failsafe::detail::to_error_code;
+
+    // Throw counters, used by THROW and the enforcer
+    using failsafe::detail::max_throw_sites;
+    using failsafe::detail::throw_site_record;
+    using failsafe::detail::count_throw;
+    using failsafe::detail::throw_counts;
+    using failsafe::detail::reset_throw_counts;
+    using failsafe::detail::current_throw_expression;
+    using failsafe::detail::throw_expression_scope;
+}
@@ -0,0 +1,160 @@
+# =============================================================================
+# Code generation checks for disabled logging
+# =============================================================================
+#
+# Inspects an object file compiled from log_sites.cc and fails when call
+# sites that LOGGER_MIN_LEVEL disables leave anything behind, or when enabled
+# call sites inline more than the level check and a call.
+#
+# Usage:
+#   cmake -DOBJECT=<file> -DLEVEL=<TRACE|INFO|CATEGORY|OFF> -DOBJDUMP=<objdump> -DNM=<nm>
+#         -P check_codegen.cmake
+#
+# LEVEL names the configuration the object was compiled with:
+#   TRACE    - every call site is enabled (positive control for the checks)
+#   INFO     - TRACE and DEBUG sites are removed
+#   CATEGORY - INFO, but LOGGER_CATEGORY_MIN_LEVELS keeps DEBUG for "Codegen"
+#   OFF      - every call site is removed
+
+foreach(_var OBJECT LEVEL OBJDUMP NM)
+    if(NOT DEFINED ${_var})
+        message(FATAL_ERROR "check_codegen.cmake: ${_var} is not set")
+    endif()
+endforeach()
+
+function(codegen_fail message)
+    message(SEND_ERROR "[${LEVEL}] ${message}")
+endfunction()
+
+# -----------------------------------------------------------------------------
+# Marker strings of the call sites
+# -----------------------------------------------------------------------------
+
+file(STRINGS "${OBJECT}" _strings REGEX "codegen-[a-z]+-marker")
+
+function(expect_marker name present)
+    set(_found FALSE)
+    foreach(_s IN LISTS _strings)
+        if(_s MATCHES "codegen-${name}-marker")
+            set(_found TRUE)
+        endif()
+    endforeach()
+    if(present AND NOT _found)
+        codegen_fail("marker of the ${name} call site is missing")
+    elseif(NOT present AND _found)
+        codegen_fail("string literal of the disabled ${name} call site is in the object")
+    endif()
+endfunction()
+
+# -----------------------------------------------------------------------------
+# Symbols
+# -----------------------------------------------------------------------------
+
+execute_process(COMMAND "${NM}" -C "${OBJECT}"
+    OUTPUT_VARIABLE _symbols
+    RESULT_VARIABLE _nm_result)
+if(NOT _nm_result EQUAL 0)
+    message(FATAL_ERROR "${NM} failed on ${OBJECT}")
+endif()
+
+# Instantiations that only exist when a message is built
+set(_logging_symbols "build_message|log_with_level|log_impl|format_message|append_to_stream")
+
+function(expect_symbols regex present what)
+    string(REGEX MATCHALL "[^\n]*(${regex})[^\n]*" _matches "${_symbols}")
+    list(LENGTH _matches _count)
+    if(present AND _count EQUAL 0)
+        codegen_fail("expected ${what} in the object")
+    elseif(NOT present AND NOT _count EQUAL 0)
+        list(GET _matches 0 _first)
+        codegen_fail("${_count} ${what} left in the object, e.g.: ${_first}")
+    endif()
+endfunction()
+
+# -----------------------------------------------------------------------------
+# Instruction counts
+# -----------------------------------------------------------------------------
+
+include(${CMAKE_CURRENT_LIST_DIR}/disassembly.cmake)
+
+count_instructions(failsafe_codegen_empty_site _empty)
+count_instructions(failsafe_codegen_reference_loop _reference)
+count_instructions(failsafe_codegen_trace_loop _trace_loop)
+count_instructions(failsafe_codegen_category_site _category_site)
+count_instructions(failsafe_codegen_info_site _info_site)
+count_instructions(failsafe_codegen_error_site _error_site)
+
+function(expect_same_size function actual expected reference)
+    if(NOT actual EQUAL expected)
+        codegen_fail("${function} has ${actual} instructions, ${reference} has ${expected}")
+    endif()
+endfunction()
+
+# Enabled call sites only contain the level check and the out of line call;
+# the bound leaves room for argument setup but not for message building
+set(_max_enabled_site 24)
+
+function(expect_small_site function actual)
+    if(actual GREATER _max_enabled_site)
+        codegen_fail("enabled call site ${function} has ${actual} instructions, "
+                     "expected at most ${_max_enabled_site}")
+    endif()
+endfunction()
+
+# -----------------------------------------------------------------------------
+# Expectations per level
+# -----------------------------------------------------------------------------
+
+if(NOT LEVEL STREQUAL "OFF")
+    expect_small_site(failsafe_codegen_info_site ${_info_site})
+    expect_small_site(failsafe_codegen_error_site ${_error_site})
+endif()
+
+if(LEVEL STREQUAL "TRACE")
+    expect_marker(trace TRUE)
+    expect_marker(debug TRUE)
+    expect_marker(stripped TRUE)
+    expect_marker(info TRUE)
+    expect_marker(error TRUE)
+    expect_symbols("${_logging_symbols}" TRUE "message building instantiations")
+    # The loop checks below are only meaningful if logging shows up in the count
+    if(NOT _trace_loop GREATER _reference)
+        codegen_fail("enabled logging did not change the instruction count of the loop")
+    endif()
+elseif(LEVEL STREQUAL "INFO")
+    expect_marker(trace FALSE)
+    expect_marker(debug FALSE)
+    expect_marker(stripped FALSE)
+    expect_marker(info TRUE)
+    expect_marker(error TRUE)
+    expect_symbols("${_logging_symbols}" TRUE "message building instantiations")
+    expect_same_size(failsafe_codegen_trace_loop ${_trace_loop} ${_reference} failsafe_codegen_reference_loop)
+    expect_same_size(failsafe_codegen_category_site ${_category_site} ${_empty} failsafe_codegen_empty_site)
+elseif(LEVEL STREQUAL "CATEGORY")
+    expect_marker(trace FALSE)
+    expect_marker(debug TRUE)
+    expect_marker(stripped FALSE)
+    expect_marker(info TRUE)
+    expect_marker(error TRUE)
+    if(NOT _trace_loop GREATER _reference)
+        codegen_fail("DEBUG logging kept for its category is missing from the loop")
+    endif()
+    expect_same_size(failsafe_codegen_category_site ${_category_site} ${_empty} failsafe_codegen_empty_site)
+elseif(LEVEL STREQUAL "OFF")
+    expect_marker(trace FALSE)
+    expect_marker(debug FALSE)
+    expect_marker(stripped FALSE)
+    expect_marker(info FALSE)
+    expect_marker(error FALSE)
+    expect_symbols("${_logging_symbols}" FALSE "message building instantiations")
+    expect_symbols("failsafe_codegen_expensive" FALSE "references to arguments of disabled call sites")
+    expect_same_size(failsafe_codegen_trace_loop ${_trace_loop} ${_reference} failsafe_codegen_reference_loop)
+    expect_same_size(failsafe_codegen_info_site ${_info_site} ${_empty} failsafe_codegen_empty_site)
+    expect_same_size(failsafe_codegen_error_site ${_error_site} ${_empty} failsafe_codegen_empty_site)
+else()
+    message(FATAL_ERROR "check_codegen.cmake: unknown LEVEL '${LEVEL}'")
+endif()
+
+message(STATUS "[${LEVEL}] loop: ${_trace_loop}/${_reference} instructions, "
+               "category site: ${_category_site}, info site: ${_info_site}, "
+               "error site: ${_error_site}, empty: ${_empty}")
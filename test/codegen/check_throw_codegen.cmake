@@ -0,0 +1,52 @@
+# =============================================================================
+# Code generation checks for THROW/TRAP/ENFORCE call sites
+# =============================================================================
+#
+# Inspects an object file compiled from throw_sites.cc and fails when a
+# validation loop using THROW_IF, TRAP_IF, DEBUG_TRAP_RELEASE_THROW or ENFORCE
+# keeps more in its hot part than the hand-written reference loop.
+#
+# Usage:
+#   cmake -DOBJECT=<file> -DOBJDUMP=<objdump> -P check_throw_codegen.cmake
+
+foreach(_var OBJECT OBJDUMP)
+    if(NOT DEFINED ${_var})
+        message(FATAL_ERROR "check_throw_codegen.cmake: ${_var} is not set")
+    endif()
+endforeach()
+
+file(STRINGS "${OBJECT}" _strings REGEX "codegen-[a-z]+-marker")
+foreach(_name throw trap release enforce)
+    if(NOT _strings MATCHES "codegen-${_name}-marker")
+        message(SEND_ERROR "marker of the ${_name} call site is missing")
+    endif()
+endforeach()
+
+include(${CMAKE_CURRENT_LIST_DIR}/disassembly.cmake)
+
+count_instructions(failsafe_codegen_reference_check_loop _reference)
+count_instructions(failsafe_codegen_reference_pointer_loop _pointer_reference)
+
+# Compilers that split functions move the failure branch into a .cold part
+# and match the reference exactly; others keep the argument setup of the
+# failure call at the end of the function
+set(_max_extra 16)
+
+function(expect_out_of_line_failure loop reference)
+    count_instructions(failsafe_codegen_${loop}_loop _count)
+    math(EXPR _extra "${_count} - ${reference}")
+    if(_extra GREATER _max_extra)
+        message(SEND_ERROR "failsafe_codegen_${loop}_loop has ${_count} instructions, the reference "
+                           "loop ${reference}; the failure path is not out of line")
+    endif()
+    set(_summary "${_summary} ${loop}: ${_count}" PARENT_SCOPE)
+endfunction()
+
+foreach(_loop throw_if trap_if release_throw)
+    expect_out_of_line_failure(${_loop} ${_reference})
+endforeach()
+foreach(_loop enforce enforce_message)
+    expect_out_of_line_failure(${_loop} ${_pointer_reference})
+endforeach()
+
+message(STATUS "reference loops: ${_reference}/${_pointer_reference} instructions,${_summary}")
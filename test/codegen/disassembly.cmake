@@ -0,0 +1,38 @@
+# =============================================================================
+# Disassembly helpers for the code generation checks
+# =============================================================================
+#
+# Included by the check_*.cmake scripts after OBJECT and OBJDUMP are set.
+# Provides count_instructions(<function> <out-var>).
+
+execute_process(COMMAND "${OBJDUMP}" -d --no-show-raw-insn "${OBJECT}"
+    OUTPUT_VARIABLE _disassembly
+    RESULT_VARIABLE _objdump_result)
+if(NOT _objdump_result EQUAL 0)
+    message(FATAL_ERROR "${OBJDUMP} failed on ${OBJECT}")
+endif()
+string(REPLACE ";" "\;" _disassembly "${_disassembly}")
+string(REPLACE "\n" ";" _disassembly_lines "${_disassembly}")
+
+# Number of instructions of a C linkage function (Mach-O adds a leading '_'),
+# not counting the nop padding up to the next function. Blocks the compiler
+# moved to a separate <function>.cold part are not counted.
+function(count_instructions function out)
+    set(_inside FALSE)
+    set(_count 0)
+    foreach(_line IN LISTS _disassembly_lines)
+        if(_line MATCHES "^[0-9a-fA-F]+ <_?${function}>:")
+            set(_inside TRUE)
+        elseif(_inside)
+            if(_line MATCHES "^[ \t]*$" OR _line MATCHES "^[0-9a-fA-F]+ <")
+                break()
+            elseif(_line MATCHES "^[ \t]+[0-9a-fA-F]+:" AND NOT _line MATCHES "\t(nop|xchg +%ax,%ax|data16|int3)")
+                math(EXPR _count "${_count} + 1")
+            endif()
+        endif()
+    endforeach()
+    if(NOT _inside)
+        message(FATAL_ERROR "function ${function} not found in the disassembly of ${OBJECT}")
+    endif()
+    set(${out} ${_count} PARENT_SCOPE)
+endfunction()
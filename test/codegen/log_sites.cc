@@ -0,0 +1,61 @@
+//
+// Representative logging call sites for the code generation checks.
+//
+// Compiled once per LOGGER_MIN_LEVEL setting (see test/CMakeLists.txt) and
+// inspected by check_codegen.cmake. The functions have C linkage so their
+// disassembly can be located without demangling. Every call site carries a
+// unique marker string; a marker left in the object means the call site
+// was not removed.
+//
+
+#if defined(FAILSAFE_CODEGEN_CATEGORY_TABLE)
+    // Keep DEBUG for one category on top of the global LOGGER_MIN_LEVEL
+    #define LOGGER_CATEGORY_MIN_LEVELS {"Codegen", LOGGER_LEVEL_DEBUG}
+#endif
+#include <failsafe/logger.hh>
+
+// Defined elsewhere so the compiler cannot fold the call into a constant
+int failsafe_codegen_expensive(int value);
+
+extern "C" {
+
+/// What a function with only disabled call sites must compile to
+void failsafe_codegen_empty_site(int) {
+}
+
+/// The loop every disabled-logging variant must compile to
+int failsafe_codegen_reference_loop(const int* values, int count) {
+    int sum = 0;
+    for (int i = 0; i < count; ++i) {
+        sum += values[i] * 3;
+    }
+    return sum;
+}
+
+/// Same loop with TRACE/DEBUG logging in its body
+int failsafe_codegen_trace_loop(const int* values, int count) {
+    int sum = 0;
+    for (int i = 0; i < count; ++i) {
+        LOG_TRACE("codegen-trace-marker", i, failsafe_codegen_expensive(values[i]));
+        LOG_CAT_DEBUG("Codegen", "codegen-debug-marker", values[i], std::string(64, 'x'));
+        sum += values[i] * 3;
+    }
+    return sum;
+}
+
+/// A DEBUG call site in a category without its own level
+void failsafe_codegen_category_site(int value) {
+    LOG_CAT_DEBUG("Stripped", "codegen-stripped-marker", value, failsafe_codegen_expensive(value));
+}
+
+/// A single INFO call site
+void failsafe_codegen_info_site(int value) {
+    LOG_INFO("codegen-info-marker", value, failsafe_codegen_expensive(value));
+}
+
+/// A single ERROR call site
+void failsafe_codegen_error_site(int value) {
+    LOG_ERROR("codegen-error-marker", value);
+}
+
+}
@@ -0,0 +1,97 @@
+//
+// Representative THROW_IF/TRAP_IF/ENFORCE call sites for the code generation
+// checks.
+//
+// Compiled with optimization (see test/CMakeLists.txt) and inspected by
+// check_throw_codegen.cmake. Each loop validates its input with one of the
+// macros; the loops must compile to the same hot code as the reference
+// loops, which call a cold function on failure. The functions have C
+// linkage so their disassembly can be located without demangling.
+//
+
+#include <failsafe/enforce.hh>
+#include <failsafe/exception.hh>
+
+#include <stdexcept>
+
+// Defined elsewhere; what a hand-written validation calls on failure
+[[noreturn]] FAILSAFE_COLD void failsafe_codegen_fail(int index, int value);
+[[noreturn]] FAILSAFE_COLD void failsafe_codegen_fail_null(int index);
+
+extern "C" {
+
+/// The loop every validating variant must compile to
+int failsafe_codegen_reference_check_loop(const int* values, int count) {
+    int sum = 0;
+    for (int i = 0; i < count; ++i) {
+        if (FAILSAFE_UNLIKELY(values[i] < 0)) {
+            failsafe_codegen_fail(i, values[i]);
+        }
+        sum += values[i] * 3;
+    }
+    return sum;
+}
+
+/// Validation with THROW_IF
+int failsafe_codegen_throw_if_loop(const int* values, int count) {
+    int sum = 0;
+    for (int i = 0; i < count; ++i) {
+        THROW_IF(values[i] < 0, std::invalid_argument, "codegen-throw-marker", i, values[i]);
+        sum += values[i] * 3;
+    }
+    return sum;
+}
+
+/// Validation with TRAP_IF
+int failsafe_codegen_trap_if_loop(const int* values, int count) {
+    int sum = 0;
+    for (int i = 0; i < count; ++i) {
+        TRAP_IF(values[i] < 0, "codegen-trap-marker", i, values[i]);
+        sum += values[i] * 3;
+    }
+    return sum;
+}
+
+/// Validation with DEBUG_TRAP_RELEASE_THROW (a THROW, compiled with NDEBUG)
+int failsafe_codegen_release_throw_loop(const int* values, int count) {
+    int sum = 0;
+    for (int i = 0; i < count; ++i) {
+        if (values[i] < 0) {
+            DEBUG_TRAP_RELEASE_THROW(std::out_of_range, "codegen-release-marker", i, values[i]);
+        }
+        sum += values[i] * 3;
+    }
+    return sum;
+}
+
+/// The pointer loop every ENFORCE variant must compile to
+long failsafe_codegen_reference_pointer_loop(const int* const* pointers, int count) {
+    long sum = 0;
+    for (int i = 0; i < count; ++i) {
+        if (FAILSAFE_UNLIKELY(pointers[i] == nullptr)) {
+            failsafe_codegen_fail_null(i);
+        }
+        sum += *pointers[i];
+    }
+    return sum;
+}
+
+/// Validation with ENFORCE, using the value
+long failsafe_codegen_enforce_loop(const int* const* pointers, int count) {
+    long sum = 0;
+    for (int i = 0; i < count; ++i) {
+        sum += *ENFORCE(pointers[i]);
+    }
+    return sum;
+}
+
+/// Validation with ENFORCE and a custom message
+long failsafe_codegen_enforce_message_loop(const int* const* pointers, int count) {
+    long sum = 0;
+    for (int i = 0; i < count; ++i) {
+        sum += *ENFORCE(pointers[i])("codegen-enforce-marker", i);
+    }
+    return sum;
+}
+
+}
@@ -0,0 +1,16 @@
+//
+// Must not compile: an ENFORCE_CONSTEXPR check fails in a constant
+// expression. Built by the constexpr_enforce_failure test, which expects
+// the compiler to name constant_expression_enforcement_failed.
+//
+
+#include <failsafe/enforce.hh>
+
+#include <cstddef>
+
+constexpr std::size_t table_size(std::size_t bits) {
+    return std::size_t{1} << ENFORCE_CONSTEXPR_LT(bits, 32u);
+}
+
+static_assert(table_size(8) == 256, "passing check");
+static_assert(table_size(40) != 0, "failing check");
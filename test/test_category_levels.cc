@@ -0,0 +1,87 @@
+#include <doctest/doctest.h>
+
+// Release-style configuration: INFO and up everywhere, DEBUG kept for "Network"
+// and everything kept for "Storage"; "Noisy" is stricter than the global level
+#define LOGGER_MIN_LEVEL LOGGER_LEVEL_INFO
+#define LOGGER_CATEGORY_MIN_LEVELS \
+    {"Network", LOGGER_LEVEL_DEBUG}, {"Storage", LOGGER_LEVEL_TRACE}, {"Noisy", LOGGER_LEVEL_ERROR}
+#include <failsafe/logger.hh>
+
+#include <string>
+#include <vector>
+
+namespace {
+    std::vector<std::string> g_evaluated;
+
+    std::string track(const char* what) {
+        g_evaluated.emplace_back(what);
+        return what;
+    }
+}
+
+// Compile-time table lookups
+static_assert(failsafe::logger::category_compile_time_min_level("Network") == LOGGER_LEVEL_DEBUG);
+static_assert(failsafe::logger::category_compile_time_min_level("Storage") == LOGGER_LEVEL_TRACE);
+static_assert(failsafe::logger::category_compile_time_min_level("Other") == LOGGER_LEVEL_INFO);
+static_assert(failsafe::logger::is_category_level_compiled_in(LOGGER_LEVEL_DEBUG, "Network"));
+static_assert(!failsafe::logger::is_category_level_compiled_in(LOGGER_LEVEL_TRACE, "Network"));
+static_assert(!failsafe::logger::is_category_level_compiled_in(LOGGER_LEVEL_WARN, "Noisy"));
+
+TEST_CASE("Per-category compile-time minimum levels") {
+    using namespace failsafe;
+
+    auto original_level = logger::get_config().min_level.load();
+    logger::set_min_level(LOGGER_LEVEL_TRACE);
+    std::vector<std::string> logged;
+    logger::set_backend([&logged](int, const char* category, const char*, int, const std::string& message) {
+        logged.push_back(std::string(category) + ": " + message);
+    });
+    g_evaluated.clear();
+
+    SUBCASE("Listed categories use their own level") {
+        LOG_CAT_TRACE("Network", track("net-trace"));
+        LOG_CAT_DEBUG("Network", track("net-debug"));
+        LOG_CAT_TRACE("Storage", track("storage-trace"));
+        LOG_CAT_WARN("Noisy", track("noisy-warn"));
+        LOG_CAT_ERROR("Noisy", track("noisy-error"));
+
+        CHECK(g_evaluated == std::vector<std::string>{"net-debug", "storage-trace", "noisy-error"});
+        CHECK(logged == std::vector<std::string>{"Network: net-debug", "Storage: storage-trace",
+                                                 "Noisy: noisy-error"});
+    }
+
+    SUBCASE("Other categories use LOGGER_MIN_LEVEL") {
+        LOG_CAT_DEBUG("Other", track("other-debug"));
+        LOG_CAT_INFO("Other", track("other-info"));
+
+        CHECK(g_evaluated == std::vector<std::string>{"other-info"});
+        CHECK(logged == std::vector<std::string>{"Other: other-info"});
+    }
+
+    SUBCASE("Runtime level still applies to compiled-in calls") {
+        logger::set_min_level(LOGGER_LEVEL_INFO);
+        LOG_CAT_DEBUG("Network", track("net-debug"));
+
+        CHECK(g_evaluated.empty());
+        CHECK(logged.empty());
+    }
+
+    SUBCASE("Macros without category keep LOGGER_MIN_LEVEL") {
+        LOG_DEBUG(track("default-debug"));
+        LOG_INFO(track("default-info"));
+
+        CHECK(g_evaluated == std::vector<std::string>{"default-info"});
+    }
+
+#if FAILSAFE_HAS_FORMAT_STRING
+    SUBCASE("Format string variants") {
+        LOG_CAT_DEBUG_F("Network", "id={}", 7);
+        LOG_CAT_DEBUG_F("Other", "id={}", 8);
+
+        CHECK(logged == std::vector<std::string>{"Network: id=7"});
+    }
+#endif
+
+    logger::reset_backend();
+    logger::set_min_level(original_level);
+}
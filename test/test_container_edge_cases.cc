@@ -11,10 +11,53 @@
 #include <list>
 #include <forward_list>
 #include <numeric>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <type_traits>
 #include "strings_helper.hh"
 
 using namespace failsafe::detail;
 
+namespace {
+    // Forward range without size() that counts how far it is iterated
+    struct counting_range {
+        using value_type = int;
+
+        struct iterator {
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = int;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const int*;
+            using reference = const int&;
+
+            int value = 0;
+            std::size_t* steps = nullptr;
+
+            const int& operator*() const { return value; }
+            iterator& operator++() {
+                ++value;
+                ++*steps;
+                return *this;
+            }
+            iterator operator++(int) {
+                iterator previous = *this;
+                ++*this;
+                return previous;
+            }
+            bool operator==(const iterator& other) const { return value == other.value; }
+            bool operator!=(const iterator& other) const { return value != other.value; }
+        };
+
+        int count;
+        std::size_t* steps;
+
+        iterator begin() const { return {0, steps}; }
+        iterator end() const { return {count, steps}; }
+    };
+}
+
 TEST_SUITE("container edge cases and advanced features") {
     TEST_CASE("container formatter with extreme values") {
         SUBCASE("very large container") {
@@ -192,6 +235,98 @@ TEST_SUITE("container edge cases and advanced features") {
         }
     }
     
+    TEST_CASE("bounded iteration") {
+        SUBCASE("non-sized range is not walked past max_items") {
+            std::size_t steps = 0;
+            counting_range range{1000000, &steps};
+            CHECK(build_message(container(range, 3)) == "[0, 1, 2, ...]");
+            CHECK(steps <= 4);
+        }
+
+        SUBCASE("start index on a non-sized range") {
+            std::size_t steps = 0;
+            counting_range range{10, &steps};
+            CHECK(build_message(container(range, [](auto& fmt) {
+                fmt.start_index = 8;
+                fmt.max_items = 5;
+            })) == "[8, 9]");
+            CHECK(build_message(container(range, [](auto& fmt) { fmt.start_index = 10; })) == "[]");
+        }
+
+        SUBCASE("forward_list exactly at the limit is not truncated") {
+            std::forward_list<int> list{1, 2, 3};
+            CHECK(build_message(container(list, 3)) == "[1, 2, 3]");
+            CHECK(build_message(container(list, 2)) == "[1, 2, ...]");
+        }
+
+        SUBCASE("lvalues are referenced, temporaries are owned") {
+            std::vector<int> vec{1, 2, 3};
+            auto ref = container(vec, 2);
+            static_assert(std::is_same_v<decltype(ref.value), const std::vector<int>&>);
+            CHECK(&ref.value == &vec);
+
+            auto owned = container(std::vector<int>{4, 5, 6}, 2);
+            static_assert(std::is_same_v<decltype(owned.value), std::vector<int>>);
+            CHECK(build_message(owned) == "[4, 5, ...]");
+        }
+    }
+
+    TEST_CASE("numeric fast path") {
+        auto stream = [](const auto& values) {
+            std::ostringstream oss;
+            bool first = true;
+            for (const auto& v : values) {
+                oss << (first ? "" : ", ") << v;
+                first = false;
+            }
+            return "[" + oss.str() + "]";
+        };
+
+        SUBCASE("integers of every width") {
+            std::vector<std::int64_t> wide{0, -1, std::numeric_limits<std::int64_t>::min(),
+                                           std::numeric_limits<std::int64_t>::max()};
+            std::array<std::uint16_t, 3> narrow{0, 7, 65535};
+            CHECK(build_message(wide) == stream(wide));
+            CHECK(build_message(narrow) == stream(narrow));
+        }
+
+        SUBCASE("floating point matches operator<<") {
+            std::vector<double> doubles{0.0, -0.0, 3.14, 1e-5, 1e6, 123456789.0, 1.0 / 3.0, -2.5e-300};
+            std::array<float, 3> floats{1.5f, 3.14f, 1e10f};
+            CHECK(build_message(doubles) == stream(doubles));
+            CHECK(build_message(floats) == stream(floats));
+        }
+
+        SUBCASE("truncation, offsets and custom delimiters") {
+            std::vector<int> values(100000);
+            std::iota(values.begin(), values.end(), 0);
+            CHECK(build_message(container(values, 3)) == "[0, 1, 2, ...]");
+            CHECK(build_message(container(values, [](auto& fmt) {
+                fmt.start_index = 99998;
+                fmt.delimiter = "; ";
+            })) == "[99998; 99999]");
+        }
+
+        SUBCASE("large output spans several buffer flushes") {
+            std::vector<int> values(5000, -123456);
+            const std::string result = build_message(values);
+            CHECK(result.size() == 2 + 5000 * 7 + 4999 * 2);
+            CHECK(result == stream(values));
+        }
+
+        SUBCASE("character element types still print as characters") {
+            std::vector<char> chars{'a', 'b'};
+            CHECK(build_message(chars) == "[a, b]");
+        }
+
+        SUBCASE("stream state is honoured") {
+            std::ostringstream oss;
+            oss << std::hex;
+            append_to_stream(oss, std::vector<int>{255, 16});
+            CHECK(oss.str() == "[ff, 10]");
+        }
+    }
+
     TEST_CASE("interaction with existing types") {
         SUBCASE("std::array is formatted as sequence not tuple") {
             std::array<int, 3> arr = {1, 2, 3};
@@ -4,12 +4,54 @@
 
 #include <doctest/doctest.h>
 #include <failsafe/enforce.hh>
+#include <cstddef>
+#include <limits>
+#include <list>
 #include <string>
 #include <vector>
 #include <memory>
 
 using namespace failsafe::enforce;
 
+namespace {
+    constexpr std::size_t table_size(std::size_t bits) {
+        return std::size_t{1} << ENFORCE_CONSTEXPR_LT(bits, 32u);
+    }
+
+    struct layout {
+        std::size_t header;
+        std::size_t payload;
+    };
+
+    constexpr layout make_layout(std::size_t header, std::size_t total) {
+        ENFORCE_CONSTEXPR_LE(header, total);
+        return layout{header, ENFORCE_CONSTEXPR(total - header)};
+    }
+
+    constexpr int answer = 42;
+
+    // Checked while compiling; a failing check is a compile error
+    // (see compile_fail/constexpr_enforce.cc)
+    static_assert(table_size(8) == 256);
+    static_assert(make_layout(4, 16).payload == 12);
+    static_assert(ENFORCE_CONSTEXPR_IN_RANGE(answer, 0, 100) == 42);
+    static_assert(ENFORCE_CONSTEXPR_EQ(answer, 42) == 42);
+    static_assert(ENFORCE_CONSTEXPR_NE(answer, 0) == 42);
+    static_assert(ENFORCE_CONSTEXPR_GT(answer, 0) == 42);
+    static_assert(ENFORCE_CONSTEXPR_GE(answer, 42) == 42);
+    static_assert(ENFORCE_CONSTEXPR_LE(answer, 42) == 42);
+
+    constexpr int clamp_checked(int value, int bound) {
+        return ENFORCE_CONSTEXPR_LE(value, bound);
+    }
+
+    static_assert(clamp_checked(3, 5) == 3);
+
+    int value_of(int value) {
+        return value;
+    }
+}
+
 TEST_SUITE("Enforce Mechanism") {
     TEST_CASE("Basic ENFORCE macro") {
         SUBCASE("True condition passes") {
@@ -42,6 +84,47 @@ TEST_SUITE("Enforce Mechanism") {
             }());
         }
         
+        SUBCASE("Failure in a destructor run by unwinding is raised") {
+            struct guard {
+                bool& raised;
+                ~guard() {
+                    int* ptr = nullptr;
+                    try {
+                        ENFORCE(ptr);
+                    } catch (const std::runtime_error&) {
+                        raised = true;
+                    }
+                }
+            };
+
+            bool raised = false;
+            try {
+                guard g{raised};
+                throw std::logic_error("unwinding");
+            } catch (const std::logic_error&) {
+            }
+            CHECK(raised);
+        }
+
+        SUBCASE("Failure is raised once when accessed") {
+            int* ptr = nullptr;
+            int raised = 0;
+            try {
+                int* result = ENFORCE(ptr);
+                (void)result;
+            } catch (const std::runtime_error&) {
+                ++raised;
+            }
+            CHECK(raised == 1);
+        }
+
+        SUBCASE("Failure does not replace a later exception of its expression") {
+            int* ptr = nullptr;
+            auto fail = []() -> int { throw std::logic_error("later"); };
+            // Printed instead of raised, std::terminate() otherwise
+            CHECK_THROWS_AS(((void)ENFORCE(ptr), fail()), std::logic_error);
+        }
+
         SUBCASE("Value pass-through") {
             int* ptr = new int(42);
             int* result = ENFORCE(ptr);
@@ -183,6 +266,28 @@ TEST_SUITE("Enforce Mechanism") {
             CHECK(not_empty == true);
         }
         
+        SUBCASE("Failed check raises before the value is used") {
+            std::vector<int> used;
+            auto use = [&used](int value) {
+                used.push_back(value);
+                return value;
+            };
+
+            int zero = 0;
+            CHECK_THROWS_AS(use(ENFORCE(zero)), std::runtime_error);
+            CHECK(used.empty());
+
+            try {
+                use(ENFORCE_EQ(zero, 1));
+                FAIL("Should have thrown");
+            } catch (const std::exception& e) {
+                std::string msg(e.what());
+                CHECK(msg.find("zero == 1") != std::string::npos);
+                CHECK(msg.find("Values must be equal") != std::string::npos);
+            }
+            CHECK(used.empty());
+        }
+        
         SUBCASE("Chaining multiple messages") {
             // Only the first message call should be used
             try {
@@ -195,6 +300,163 @@ TEST_SUITE("Enforce Mechanism") {
         }
     }
     
+    TEST_CASE("Enforced values are not copied") {
+        struct counted {
+            int* copies;
+            int* moves;
+            bool valid = true;
+
+            counted(int* c, int* m) : copies(c), moves(m) {}
+            counted(const counted& other) : copies(other.copies), moves(other.moves), valid(other.valid) { ++*copies; }
+            counted(counted&& other) noexcept : copies(other.copies), moves(other.moves), valid(other.valid) { ++*moves; }
+            explicit operator bool() const { return valid; }
+        };
+
+        int copies = 0;
+        int moves = 0;
+
+        SUBCASE("Lvalues are bound by reference") {
+            counted value(&copies, &moves);
+            counted& checked = ENFORCE(value).get();
+            CHECK(&checked == &value);
+
+            const counted& converted = ENFORCE(value)("not valid");
+            CHECK(&converted == &value);
+
+            int size = 1000;
+            ENFORCE_GT(size, 0).get() = 10;
+            CHECK(size == 10);
+            CHECK(copies == 0);
+            CHECK(moves == 0);
+        }
+
+        SUBCASE("Rvalues are moved, never copied") {
+            counted value = ENFORCE(counted(&copies, &moves));
+            CHECK(value.valid);
+            CHECK(copies == 0);
+            CHECK(moves == 2);
+
+            moves = 0;
+            counted with_message = ENFORCE(counted(&copies, &moves))("not valid");
+            CHECK(with_message.valid);
+            CHECK(copies == 0);
+            CHECK(moves == 2);
+        }
+
+        SUBCASE("Move-only values") {
+            std::unique_ptr<int> ptr = ENFORCE(std::make_unique<int>(42));
+            REQUIRE(ptr);
+            CHECK(*ptr == 42);
+
+            std::unique_ptr<int> other = ENFORCE(std::make_unique<int>(7))("allocation failed");
+            CHECK(*other == 7);
+
+            CHECK_THROWS_AS(std::unique_ptr<int>(ENFORCE(std::unique_ptr<int>())), std::runtime_error);
+        }
+
+        SUBCASE("Failed checks of bound lvalues") {
+            counted value(&copies, &moves);
+            value.valid = false;
+            CHECK_THROWS_AS(ENFORCE(value).get(), std::runtime_error);
+            CHECK(copies == 0);
+        }
+    }
+    
+    TEST_CASE("Bulk enforcement") {
+        SUBCASE("Passing ranges are returned") {
+            std::vector<int> values(1000, 5);
+            std::vector<int>& checked = ENFORCE_ALL_IN_RANGE(values, 0, 10);
+            CHECK(&checked == &values);
+
+            int indices[] = {0, 3, 9};
+            ENFORCE_ALL_VALID_INDEX(indices, 10u);
+
+            std::vector<double> samples = {0.5, -1.0, 2.0};
+            ENFORCE_ALL_NOT_NAN(samples);
+
+            int a = 1;
+            int b = 2;
+            std::vector<int*> pointers = {&a, &b};
+            ENFORCE_ALL(pointers);
+
+            std::vector<int> empty;
+            ENFORCE_ALL_IN_RANGE(empty, 0, 0);
+        }
+
+        SUBCASE("First offending element is reported") {
+            std::vector<int> values(1000, 5);
+            values[700] = 42;
+            values[900] = -1;
+            try {
+                ENFORCE_ALL_IN_RANGE(values, 0, 10);
+                FAIL("Should have thrown");
+            } catch (const std::runtime_error& e) {
+                std::string msg(e.what());
+                CHECK(msg.find("all of values in [0, 10]") != std::string::npos);
+                CHECK(msg.find("element 700 is 42") != std::string::npos);
+            }
+        }
+
+        SUBCASE("NaN, null pointers and invalid indices") {
+            auto failure_of = [](auto&& check) -> std::string {
+                try {
+                    check();
+                } catch (const std::runtime_error& e) {
+                    return e.what();
+                }
+                return "no exception";
+            };
+
+            std::vector<double> samples = {0.5, std::numeric_limits<double>::quiet_NaN()};
+            CHECK(failure_of([&] { ENFORCE_ALL_NOT_NAN(samples); }).find("element 1") != std::string::npos);
+
+            int a = 1;
+            std::vector<int*> pointers = {&a, nullptr, &a};
+            CHECK(failure_of([&] { ENFORCE_ALL(pointers); }).find("element 1") != std::string::npos);
+
+            std::vector<int> indices = {1, -1, 2};
+            CHECK(failure_of([&] { ENFORCE_ALL_VALID_INDEX(indices, 3u); }).find("element 1 is -1") != std::string::npos);
+        }
+
+        SUBCASE("Non-contiguous ranges and custom raisers") {
+            std::list<int> values = {1, 2, 3};
+            CHECK_THROWS_AS(enforce_all<raisers::exception_raiser<std::out_of_range>>(
+                                values, predicates::less_than<int>{3}, "values < 3", __FILE__, __LINE__),
+                            std::out_of_range);
+            CHECK(enforce_all(values, predicates::less_than<int>{4}, "values < 4", __FILE__, __LINE__).size() == 3);
+        }
+    }
+    
+    TEST_CASE("Compile-time enforcement at run time") {
+        std::size_t bits = 8;
+        CHECK(table_size(bits) == 256);
+
+        bits = 40;
+        try {
+            table_size(bits);
+            FAIL("Should have thrown");
+        } catch (const std::runtime_error& e) {
+            std::string msg(e.what());
+            CHECK(msg.find("bits < 32u") != std::string::npos);
+            CHECK(msg.find("Value must be less than bound") != std::string::npos);
+        }
+
+        std::size_t total = 2;
+        try {
+            make_layout(4, total);
+            FAIL("Should have thrown");
+        } catch (const std::runtime_error& e) {
+            std::string msg(e.what());
+            CHECK(msg.find("header <= total") != std::string::npos);
+            CHECK(msg.find("Value must be less than or equal to bound") != std::string::npos);
+        }
+        CHECK(clamp_checked(value_of(3), 5) == 3);
+
+        int value = 7;
+        int& same = ENFORCE_CONSTEXPR(value);
+        CHECK(&same == &value);
+    }
+    
     TEST_CASE("Debug enforce") {
         #ifdef NDEBUG
             // In release mode, DEBUG_ENFORCE should do nothing
@@ -7,6 +7,7 @@
 #include <string>
 #include <stdexcept>
 #include <exception>
+#include <vector>
 
 // Custom exception for testing
 class CustomException : public std::exception {
@@ -248,4 +249,69 @@ TEST_SUITE("Exception Macros - Default std::runtime_error") {
     TEST_CASE("THROW_DEFAULT with std::runtime_error") {
         CHECK_THROWS_AS(THROW_DEFAULT("Runtime default"), std::runtime_error);
     }
-}
\ No newline at end of file
+}
+
+// Lazily formatted exception type
+class LazyParseError : public failsafe::exception::lazy_error {
+public:
+    using lazy_error::lazy_error;
+};
+
+TEST_SUITE("Exception Macros - lazy_error") {
+    TEST_CASE("what() matches the eagerly built message") {
+        std::string token = "ident";
+        std::string eager;
+        std::string lazy;
+        try {
+            THROW(std::runtime_error, "unexpected", token, "at", 42, 1.5, true, failsafe::detail::hex(255));
+        } catch (const std::exception& e) {
+            eager = e.what();
+        }
+        try {
+            THROW(LazyParseError, "unexpected", token, "at", 42, 1.5, true, failsafe::detail::hex(255));
+        } catch (const std::exception& e) {
+            lazy = e.what();
+        }
+        // Same format, different line
+        CHECK(lazy.substr(lazy.find(']')) == eager.substr(eager.find(']')));
+        CHECK(lazy.find("unexpected ident at 42 1.5 true 0xff") != std::string::npos);
+    }
+
+    TEST_CASE("arguments are copied at throw time") {
+        try {
+            std::string temporary = "short-lived";
+            std::vector<int> values{1, 2, 3};
+            THROW(LazyParseError, temporary, values);
+        } catch (const LazyParseError& e) {
+            std::string message(e.what());
+            CHECK(message.find("short-lived [1, 2, 3]") != std::string::npos);
+            CHECK(e.line() > 0);
+            CHECK(std::string(e.file()).find("test_exception.cc") != std::string::npos);
+            // Built once, then cached
+            CHECK(e.what() == e.what());
+        }
+    }
+
+    TEST_CASE("copies share the captured message") {
+        try {
+            THROW(failsafe::exception::lazy_error, "shared");
+        } catch (const failsafe::exception::lazy_error& e) {
+            failsafe::exception::lazy_error copy(e);
+            CHECK(std::string(copy.what()) == e.what());
+        }
+    }
+
+    TEST_CASE("chains with the current exception") {
+        try {
+            try {
+                THROW(std::runtime_error, "inner");
+            } catch (...) {
+                THROW(LazyParseError, "outer");
+            }
+        } catch (const std::exception& e) {
+            std::string trace = failsafe::exception::get_nested_trace(e);
+            CHECK(trace.find("outer") != std::string::npos);
+            CHECK(trace.find("inner") != std::string::npos);
+        }
+    }
+}
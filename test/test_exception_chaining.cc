@@ -1,7 +1,10 @@
 #include <doctest/doctest.h>
 #include <failsafe/exception.hh>
+#include <algorithm>
+#include <stdexcept>
 #include <string>
 #include <fstream>
+#include <typeinfo>
 
 // Skip chaining tests on clang-cl where std::throw_with_nested is broken
 #ifdef FAILSAFE_DISABLE_EXCEPTION_CHAINING
@@ -10,6 +13,16 @@
 #define SKIP_CHAINING_TEST do {} while(0)
 #endif
 
+// Runs a check with chain recording off, then on
+template<typename F>
+void with_each_chain_mode(F&& check) {
+    for (bool recording : {false, true}) {
+        failsafe::exception::set_chain_recording(recording);
+        check();
+    }
+    failsafe::exception::set_chain_recording(false);
+}
+
 // Simulate file operations
 std::string read_file(const std::string& path) {
     if (path == "missing.txt") {
@@ -200,4 +213,114 @@ TEST_CASE("Exception trace formatting") {
         CHECK(output.find("Inner error") != std::string::npos);
         CHECK(output.find("Outer error") != std::string::npos);
     }
-}
\ No newline at end of file
+}
+TEST_CASE("Chains mixed with foreign nesting") {
+    SKIP_CHAINING_TEST;
+    using namespace failsafe::exception;
+
+    SUBCASE("Failsafe and foreign levels") {
+        with_each_chain_mode([] {
+            try {
+                try {
+                    try {
+                        try {
+                            throw std::logic_error("Foreign root");
+                        } catch (...) {
+                            THROW(std::runtime_error, "Level 1");
+                        }
+                    } catch (...) {
+                        std::throw_with_nested(std::out_of_range("Foreign middle"));
+                    }
+                } catch (...) {
+                    THROW(std::runtime_error, "Level 3");
+                }
+            } catch (...) {
+                try {
+                    THROW(std::invalid_argument, "Level 4");
+                } catch (const std::invalid_argument& e) {
+                    // Still catchable like std::throw_with_nested results
+                    CHECK(dynamic_cast<const std::nested_exception*>(&e) != nullptr);
+
+                    const std::string trace = get_nested_trace(e);
+                    const std::string::size_type positions[] = {
+                        trace.find("Level 4"), trace.find("Level 3"), trace.find("Foreign middle"),
+                        trace.find("Level 1"), trace.find("Foreign root")
+                    };
+                    for (std::size_t i = 0; i < 5; ++i) {
+                        REQUIRE(positions[i] != std::string::npos);
+                        if (i > 0) {
+                            CHECK(positions[i - 1] < positions[i]);
+                        }
+                    }
+                    CHECK(std::count(trace.begin(), trace.end(), '\n') == 5);
+                    CHECK(trace.rfind("        → Foreign root\n") != std::string::npos);
+
+                    // An indent level offsets every line
+                    CHECK(get_nested_trace(e, 1).find("  → ") == 0);
+                }
+            }
+        });
+    }
+
+    SUBCASE("Recorded levels are linked") {
+        auto throw_chain = [] {
+            try {
+                try {
+                    THROW(std::runtime_error, "Deep");
+                } catch (...) {
+                    THROW(std::runtime_error, "Middle");
+                }
+            } catch (...) {
+                THROW(std::runtime_error, "Top");
+            }
+        };
+
+        set_chain_recording(true);
+        try {
+            throw_chain();
+        } catch (const std::exception& e) {
+            const auto* link = dynamic_cast<const internal::trace_link*>(&e);
+            REQUIRE(link != nullptr);
+            const internal::trace_node& top = link->trace();
+            REQUIRE(top.next != nullptr);
+            CHECK(std::string(top.next->exception().what()).find("Middle") != std::string::npos);
+            // Thrown outside a handler, so not recorded: read by rethrowing
+            CHECK(top.next->next == nullptr);
+            CHECK(top.next->foreign != nullptr);
+        }
+        set_chain_recording(false);
+
+        try {
+            throw_chain();
+        } catch (const std::exception& e) {
+            CHECK(dynamic_cast<const internal::trace_link*>(&e) == nullptr);
+            CHECK(dynamic_cast<const std::nested_exception*>(&e) != nullptr);
+        }
+    }
+
+    SUBCASE("Exceptions thrown outside handlers are thrown directly") {
+        with_each_chain_mode([] {
+            try {
+                THROW(std::runtime_error, "Top level");
+            } catch (const std::exception& e) {
+                CHECK(typeid(e) == typeid(std::runtime_error));
+            }
+        });
+    }
+
+    SUBCASE("Unknown nested exceptions") {
+        with_each_chain_mode([] {
+            try {
+                try {
+                    throw 42;
+                } catch (...) {
+                    THROW(std::runtime_error, "Wrapped int");
+                }
+            } catch (const std::exception& e) {
+                const std::string trace = get_nested_trace(e);
+                CHECK(trace.find("Wrapped int") != std::string::npos);
+                CHECK(trace.find("  → [unknown nested exception]\n") != std::string::npos);
+            }
+        });
+    }
+}
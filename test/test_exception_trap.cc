@@ -45,6 +45,10 @@ TEST_SUITE("Exception Trap Macros") {
         SUBCASE("TRAP macro compiles") {
             // This would trap if executed
             // TRAP("This would trap");
+            if (false) {
+                TRAP("This would trap", 42);
+                TRAP();
+            }
             CHECK(true); // Just verify compilation
         }
         
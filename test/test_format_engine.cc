@@ -0,0 +1,117 @@
+//
+// Unit tests for message building independent of the selected format engine
+//
+
+#include <failsafe/detail/string_utils.hh>
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+    struct stream_only {
+        int id;
+    };
+
+    std::ostream& operator<<(std::ostream& os, const stream_only& value) {
+        return os << "stream_only#" << value.id;
+    }
+
+    // Leaves the stream in hex mode on purpose
+    struct leaky_flags {
+        int value;
+    };
+
+    std::ostream& operator<<(std::ostream& os, const leaky_flags& value) {
+        return os << std::hex << value.value;
+    }
+
+    // Builds another message while the outer one is in progress
+    struct nested_message {
+        int value;
+    };
+
+    std::ostream& operator<<(std::ostream& os, const nested_message& value) {
+        return os << failsafe::detail::build_message("inner", value.value);
+    }
+}
+
+TEST_SUITE("format engine") {
+    using namespace failsafe::detail;
+
+    TEST_CASE("arithmetic output matches std::ostream") {
+        auto stream = [](auto value) {
+            std::ostringstream oss;
+            oss << value;
+            return oss.str();
+        };
+
+        SUBCASE("integers") {
+            CHECK(build_message(0, -1, 42U, -9223372036854775807LL) == "0 -1 42 -9223372036854775807");
+            CHECK(build_message(std::uint64_t{18446744073709551615ULL}) == "18446744073709551615");
+        }
+
+        SUBCASE("floating point") {
+            for (double value : {0.0, 3.14, -2.5, 1e-5, 1e6, 123456789.0, 1.0 / 3.0}) {
+                CHECK(build_message(value) == stream(value));
+            }
+            CHECK(build_message(3.14f) == stream(3.14f));
+        }
+
+        SUBCASE("character types print as characters") {
+            CHECK(build_message('a', static_cast<signed char>('b'), static_cast<unsigned char>('c')) == "a b c");
+        }
+    }
+
+    TEST_CASE("strings and pointers") {
+        const char* null_str = nullptr;
+        char buffer[] = "mutable";
+        std::string_view view = "view";
+
+        CHECK(build_message("literal", std::string("string"), view, buffer) == "literal string view mutable");
+        CHECK(build_message("null:", null_str) == "null: nullptr");
+
+        int value = 0;
+        std::ostringstream expected;
+        expected << static_cast<const void*>(&value);
+        CHECK(build_message(&value) == expected.str());
+    }
+
+    TEST_CASE("operator<< fallback") {
+        SUBCASE("user type") {
+            CHECK(build_message("value:", stream_only{7}) == "value: stream_only#7");
+        }
+
+        SUBCASE("stream state does not leak between messages") {
+            CHECK(build_message(leaky_flags{255}) == "ff");
+            CHECK(build_message(stream_only{10}) == "stream_only#10");
+            CHECK(build_message(std::optional<int>(10)) == "10");
+        }
+
+        SUBCASE("nested message building") {
+            CHECK(build_message("outer", nested_message{5}, "done") == "outer inner 5 done");
+        }
+
+        SUBCASE("user type inside a container") {
+            std::vector<stream_only> values{{1}, {2}};
+            CHECK(build_message(values) == "[stream_only#1, stream_only#2]");
+        }
+    }
+
+    TEST_CASE("formatters") {
+        std::map<std::string, int> map{{"a", 1}, {"b", 2}};
+        std::vector<int> vec{1, 2, 3, 4, 5};
+
+        CHECK(build_message(hex(255, 4), hex(0xABU, 0, true, true), hex(0)) == "0x00ff 0xAB 0");
+        CHECK(build_message(oct(8), oct(8, 4), oct(0)) == "010 0010 0");
+        CHECK(build_message(bin(5, 4, false)) == "0101");
+        CHECK(build_message(container(vec, 3)) == "[1, 2, 3, ...]");
+        CHECK(build_message(map) == "{a: 1, b: 2}");
+    }
+}
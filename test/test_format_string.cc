@@ -0,0 +1,84 @@
+//
+// Unit tests for compile-time checked format strings
+//
+
+#include <doctest/doctest.h>
+#include <failsafe/detail/format_string.hh>
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#if FAILSAFE_HAS_FORMAT_STRING
+
+using namespace failsafe::detail;
+
+TEST_SUITE("format strings") {
+    TEST_CASE("plain placeholders") {
+        SUBCASE("no arguments") {
+            CHECK(format_message("plain text") == "plain text");
+            CHECK(format_message("") == "");
+        }
+
+        SUBCASE("arguments are not space-joined") {
+            CHECK(format_message("took {} ms for {}", 42, "query") == "took 42 ms for query");
+            CHECK(format_message("{}{}{}", 1, 2, 3) == "123");
+            CHECK(format_message("[{}]", std::string("x")) == "[x]");
+        }
+
+        SUBCASE("uses append_to_stream rules") {
+            std::vector<int> vec{1, 2, 3};
+            int* null_ptr = nullptr;
+            CHECK(format_message("{} {}", true, false) == "true false");
+            CHECK(format_message("vec={}", vec) == "vec=[1, 2, 3]");
+            CHECK(format_message("ptr={}", null_ptr) == "ptr=nullptr");
+            CHECK(format_message("{}", hex(255)) == "0xff");
+        }
+    }
+
+    TEST_CASE("escaped braces") {
+        CHECK(format_message("{{}}") == "{}");
+        CHECK(format_message("{{{}}}", 7) == "{7}");
+        CHECK(format_message("set {{{}, {}}}", 1, 2) == "set {1, 2}");
+        // Escapes do not take layout segments of their own
+        CHECK(format_message("{{a}} {{b}} {{c}} {{d}} {{e}} value {}", 5) == "{a} {b} {c} {d} {e} value 5");
+        CHECK(format_message("{{\"k1\": {}, \"k2\": {{\"k3\": {}}}, \"k4\": {{}}, \"k5\": {{{{}}}}}}", 1, 2) ==
+              "{\"k1\": 1, \"k2\": {\"k3\": 2}, \"k4\": {}, \"k5\": {{}}}");
+    }
+
+    TEST_CASE("typed placeholders") {
+        SUBCASE("hexadecimal") {
+            CHECK(format_message("{:x}", 255) == "ff");
+            CHECK(format_message("{:#x}", 255) == "0xff");
+            CHECK(format_message("{:X}", 0xABCDU) == "ABCD");
+            CHECK(format_message("{:#X}", 0xABCDU) == "0xABCD");
+            CHECK(format_message("{:x}", int8_t(-1)) == "ff");
+        }
+
+        SUBCASE("octal and binary") {
+            CHECK(format_message("{:o}", 8) == "10");
+            CHECK(format_message("{:#o}", 8) == "010");
+            CHECK(format_message("{:b}", 5) == "101");
+            CHECK(format_message("{:#b}", 5) == "0b101");
+        }
+
+        SUBCASE("pointers") {
+            int value = 0;
+            auto result = format_message("{:#x}", &value);
+            CHECK(result.substr(0, 2) == "0x");
+            CHECK(result.size() > 2);
+        }
+    }
+
+    TEST_CASE("precomputed layout") {
+        constexpr format_string<int, const char*> fmt("took {} ms for {}");
+        static_assert(fmt.size() == 4);
+        static_assert(!fmt[0].placeholder && fmt[0].length == 5);
+        static_assert(fmt[1].placeholder);
+        static_assert(!fmt[2].placeholder && fmt[2].length == 8);
+        static_assert(fmt[3].placeholder);
+        CHECK(fmt.get() == "took {} ms for {}");
+    }
+}
+
+#endif // FAILSAFE_HAS_FORMAT_STRING
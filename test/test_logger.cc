@@ -270,6 +270,36 @@ TEST_SUITE("Logger") {
         }
     }
 
+#if FAILSAFE_HAS_FORMAT_STRING
+    TEST_CASE("Format-string logging") {
+        LoggerTestFixture fixture;
+        auto& backend = fixture.backend();
+
+        SUBCASE("LOG_INFO_F") {
+            LOG_INFO_F("took {} ms for {}", 42, "query");
+            CHECK(backend.count() == 1);
+            CHECK(backend.entries()[0].level == LOGGER_LEVEL_INFO);
+            CHECK(backend.entries()[0].category == "Application");
+            CHECK(backend.entries()[0].message == "took 42 ms for query");
+        }
+
+        SUBCASE("LOG_CAT_ERROR_F with typed placeholders") {
+            LOG_CAT_ERROR_F("device", "reg {:#x} = {:b}", 16, 5);
+            CHECK(backend.count() == 1);
+            CHECK(backend.entries()[0].category == "device");
+            CHECK(backend.entries()[0].message == "reg 0x10 = 101");
+        }
+
+        SUBCASE("Level filtering") {
+            logger::set_min_level(LOGGER_LEVEL_WARN);
+            LOG_DEBUG_F("hidden {}", 1);
+            LOG_WARN_F("shown {}", 2);
+            CHECK(backend.count() == 1);
+            CHECK(backend.entries()[0].message == "shown 2");
+        }
+    }
+#endif
+
     TEST_CASE("Conditional logging") {
         LoggerTestFixture fixture;
         auto& backend = fixture.backend();
@@ -0,0 +1,42 @@
+//
+// The macros from <failsafe/macros.hh> against the `failsafe` module
+//
+
+#include <doctest/doctest.h>
+#include <failsafe/macros.hh>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+import failsafe;
+
+TEST_CASE("module: LOG_* macros reach the backend") {
+    std::vector<std::string> messages;
+    failsafe::logger::set_backend([&messages](int, const char*, const char*, int, const std::string& message) {
+        messages.push_back(message);
+    });
+
+    LOG_INFO("value", 42, failsafe::detail::hex(255));
+    LOG_CAT_WARN("Module", "category", true);
+
+    failsafe::logger::reset_backend();
+
+    REQUIRE(messages.size() == 2);
+    CHECK(messages[0] == "value 42 0xff");
+    CHECK(messages[1] == "category true");
+}
+
+TEST_CASE("module: THROW and ENFORCE macros") {
+    CHECK_THROWS_AS(THROW(std::invalid_argument, "bad", 1), std::invalid_argument);
+
+    int value = 7;
+    CHECK(ENFORCE(value > 0) == true);
+    CHECK_THROWS_AS(ENFORCE_EQ(value, 8), std::runtime_error);
+
+    try {
+        THROW_RUNTIME("outer");
+    } catch (const std::exception& e) {
+        CHECK(failsafe::exception::get_nested_trace(e).find("outer") != std::string::npos);
+    }
+}
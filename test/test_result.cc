@@ -0,0 +1,159 @@
+//
+// Unit tests for failsafe::result and the ENFORCE_RESULT* macros
+//
+// Also built with exceptions disabled (test_result_no_exceptions).
+//
+
+#include <doctest/doctest.h>
+#include <failsafe/enforce.hh>
+#include <failsafe/result.hh>
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+    static_assert(failsafe::detail::site_id("file.cc", 10) == failsafe::detail::site_id("file.cc", 10));
+    static_assert(failsafe::detail::site_id("file.cc", 10) != failsafe::detail::site_id("file.cc", 11));
+    static_assert(sizeof(failsafe::error) <= 4 * sizeof(void*), "an error record stays compact");
+
+    failsafe::result<int> checked_digit(char c) {
+        auto digit = ENFORCE_RESULT_IN_RANGE(c, '0', '9')("Not a digit:", c);
+        if (!digit) {
+            return digit.error();
+        }
+        return *digit - '0';
+    }
+
+    failsafe::result<int> two_digits(const char* text) {
+        ASSIGN_OR_PROPAGATE(int tens, checked_digit(text[0]));
+        ASSIGN_OR_PROPAGATE(int ones, checked_digit(text[1]));
+        return tens * 10 + ones;
+    }
+
+    failsafe::result<void> validate(const std::vector<int>& values) {
+        PROPAGATE_ERROR(ENFORCE_RESULT_NE(values.size(), std::size_t{0}));
+        for (int value : values) {
+            PROPAGATE_ERROR(ENFORCE_RESULT_GT(value, 0)("Not positive:", value));
+        }
+        return {};
+    }
+}
+
+TEST_SUITE("Result") {
+    TEST_CASE("Passing checks hold the value") {
+        int value = 42;
+        auto r = ENFORCE_RESULT(value);
+        REQUIRE(r.has_value());
+        CHECK(static_cast<bool>(r));
+        CHECK(r.value() == 42);
+        CHECK(*r == 42);
+
+        CHECK(ENFORCE_RESULT_EQ(value, 42).value() == 42);
+        CHECK(ENFORCE_RESULT_NE(value, 0).value() == 42);
+        CHECK(ENFORCE_RESULT_LT(value, 100).value() == 42);
+        CHECK(ENFORCE_RESULT_GT(value, 0).value() == 42);
+        CHECK(ENFORCE_RESULT_IN_RANGE(value, 0, 100).value() == 42);
+    }
+
+    TEST_CASE("Failing checks hold a compact error record") {
+        int* missing = nullptr;
+        const int line = __LINE__ + 1;
+        auto r = ENFORCE_RESULT(missing);
+        REQUIRE_FALSE(r.has_value());
+
+        const failsafe::error& e = r.error();
+        CHECK(e.line() == line);
+        CHECK(std::string(e.file()).find("test_result.cc") != std::string::npos);
+        CHECK(std::string(e.site().expression) == "missing");
+        CHECK(e.site().id == failsafe::detail::site_id(e.file(), line));
+        CHECK(std::string(e.description()) == "Expression must be true");
+        CHECK_FALSE(e.has_custom_message());
+
+        CHECK(e.message().find("Enforcement failed:") != std::string::npos);
+        CHECK(e.message().find("missing") != std::string::npos);
+        CHECK(e.to_string().find(std::to_string(line)) != std::string::npos);
+        CHECK(e.to_string().find(e.message()) != std::string::npos);
+        int fallback = 0;
+        CHECK(r.value_or(&fallback) == &fallback);
+    }
+
+    TEST_CASE("Each call site has one error site") {
+        std::vector<const failsafe::error_site*> sites;
+        for (int i = 0; i < 3; ++i) {
+            sites.push_back(&ENFORCE_RESULT_LT(i, 0).error().site());
+        }
+        auto other = ENFORCE_RESULT_LT(5, 0);
+        CHECK(sites[0] == sites[1]);
+        CHECK(sites[1] == sites[2]);
+        CHECK(&other.error().site() != sites[0]);
+        CHECK(other.error().site().id != sites[0]->id);
+        CHECK(std::string(other.error().site().expression) == "5 < 0");
+    }
+
+    TEST_CASE("Custom messages are kept for failures only") {
+        auto failed = checked_digit('x');
+        REQUIRE_FALSE(failed.has_value());
+        CHECK(failed.error().has_custom_message());
+        CHECK(failed.error().message() == "Not a digit: x");
+        CHECK(std::string(failed.error().description()) == "Value must be in range");
+
+        std::string label = "temporary";
+        auto r = ENFORCE_RESULT_EQ(1, 2)("Label:", label);
+        label = "changed";
+        CHECK(r.error().message() == "Label: temporary");
+
+        int evaluated = 0;
+        auto passed = ENFORCE_RESULT_EQ(1, 1)("Count:", ++evaluated);
+        CHECK(passed.has_value());
+        CHECK(evaluated == 1);
+    }
+
+    TEST_CASE("Errors propagate to the caller") {
+        auto ok = two_digits("42");
+        REQUIRE(ok.has_value());
+        CHECK(*ok == 42);
+
+        auto bad = two_digits("4x");
+        REQUIRE_FALSE(bad.has_value());
+        CHECK(bad.error().message() == "Not a digit: x");
+
+        CHECK(validate({1, 2, 3}).has_value());
+
+        auto empty = validate({});
+        REQUIRE_FALSE(empty.has_value());
+        CHECK(std::string(empty.error().site().expression) == "values.size() != std::size_t{0}");
+
+        auto negative = validate({1, -2, 3});
+        REQUIRE_FALSE(negative.has_value());
+        CHECK(negative.error().message() == "Not positive: -2");
+    }
+
+    TEST_CASE("Move-only values") {
+        auto r = ENFORCE_RESULT(std::make_unique<int>(7));
+        REQUIRE(r.has_value());
+        std::unique_ptr<int> owned = std::move(r).value();
+        CHECK(*owned == 7);
+
+        failsafe::result<std::unique_ptr<int>> none = ENFORCE_RESULT(std::unique_ptr<int>());
+        CHECK_FALSE(none.has_value());
+    }
+
+#if FAILSAFE_HAS_EXCEPTIONS
+    TEST_CASE("Accessing the value of an error throws") {
+        auto r = checked_digit('y');
+        try {
+            (void)r.value();
+            FAIL("Should have thrown");
+        } catch (const std::runtime_error& e) {
+            std::string msg(e.what());
+            CHECK(msg.find("Not a digit: y") != std::string::npos);
+            CHECK(msg.find("test_result.cc") != std::string::npos);
+        }
+
+        CHECK_THROWS_AS(validate({}).value(), std::runtime_error);
+    }
+#endif
+}
@@ -0,0 +1,172 @@
+//
+// Unit tests for call stack capture on THROW and its symbolization
+//
+
+#include <doctest/doctest.h>
+#include <failsafe/enforce.hh>
+#include <failsafe/exception.hh>
+
+#include <algorithm>
+#include <cstdio>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+
+using failsafe::exception::stack_capture;
+
+// External linkage and no inlining, so that traces name them (with -rdynamic)
+FAILSAFE_NOINLINE void stack_trace_test_raise(int value) {
+    THROW(std::runtime_error, "Raised with", value);
+}
+
+FAILSAFE_NOINLINE void stack_trace_test_enforce(int value) {
+    ENFORCE(value > 10);
+    std::fflush(nullptr); // not a tail call
+}
+
+FAILSAFE_NOINLINE void stack_trace_test_enforce_caller(int value) {
+    stack_trace_test_enforce(value);
+    std::fflush(nullptr); // not a tail call
+}
+
+FAILSAFE_NOINLINE void stack_trace_test_caller(int value) {
+    stack_trace_test_raise(value);
+    std::fflush(nullptr); // not a tail call
+}
+
+FAILSAFE_NOINLINE void stack_trace_test_capture(failsafe::detail::stack_trace& trace, stack_capture mode) {
+    if (mode == stack_capture::frame_pointers) {
+        trace.capture_frame_pointers();
+    } else {
+        trace.capture_unwinder();
+    }
+    std::fflush(nullptr); // not a tail call
+}
+
+namespace {
+    // Restores the default mode at the end of a test
+    struct capture_mode_scope {
+        explicit capture_mode_scope(stack_capture mode) {
+            failsafe::exception::set_stack_capture(mode);
+        }
+
+        ~capture_mode_scope() {
+            failsafe::exception::set_stack_capture(stack_capture::off);
+        }
+    };
+
+    std::string trace_of_throw(int value) {
+        try {
+            stack_trace_test_caller(value);
+        } catch (const std::runtime_error& e) {
+            return failsafe::exception::get_nested_trace(e);
+        }
+        return {};
+    }
+
+    bool has_frames(const std::string& trace) {
+        return trace.find("#0 ") != std::string::npos;
+    }
+
+    // The line of frame #n
+    std::string frame_line(const std::string& trace, int n) {
+        auto begin = trace.find("#" + std::to_string(n) + " ");
+        if (begin == std::string::npos) {
+            return {};
+        }
+        return trace.substr(begin, trace.find('\n', begin) - begin);
+    }
+}
+
+TEST_SUITE("Stack trace") {
+    TEST_CASE("Capture is off by default") {
+        CHECK(failsafe::exception::get_stack_capture() == stack_capture::off);
+        std::string trace = trace_of_throw(1);
+        CHECK(trace.find("Raised with 1") != std::string::npos);
+        CHECK_FALSE(has_frames(trace));
+        CHECK(std::count(trace.begin(), trace.end(), '\n') == 1);
+    }
+
+    TEST_CASE("Captured frames start at the caller") {
+        for (stack_capture mode : {stack_capture::frame_pointers, stack_capture::unwinder}) {
+            failsafe::detail::stack_trace trace;
+            stack_trace_test_capture(trace, mode);
+            REQUIRE_FALSE(trace.empty());
+            CHECK(trace.size() <= failsafe::detail::stack_trace::max_frames);
+
+            std::string text;
+            trace.append_to(text, 0);
+            CHECK(text.rfind("#0 ", 0) == 0);
+#if defined(__linux__) || defined(__APPLE__)
+            CHECK(text.substr(0, text.find('\n')).find("stack_trace_test_capture") != std::string::npos);
+#endif
+        }
+    }
+
+    TEST_CASE("Thrown exceptions carry their call stack") {
+        for (stack_capture mode : {stack_capture::frame_pointers, stack_capture::unwinder}) {
+            capture_mode_scope scope(mode);
+            std::string traces[2];
+            for (std::string& trace : traces) {
+                trace = trace_of_throw(2);
+            }
+            const std::string& trace = traces[0];
+            CHECK(trace.rfind("→ ", 0) == 0);
+            CHECK(trace.find("Raised with 2") != std::string::npos);
+            REQUIRE(has_frames(trace));
+            // Frames are listed below the message, one level deeper
+            CHECK(trace.find("\n  #0 ") != std::string::npos);
+#if defined(__linux__) || defined(__APPLE__)
+            auto raise = trace.find("stack_trace_test_raise");
+            auto caller = trace.find("stack_trace_test_caller");
+            CHECK(raise != std::string::npos);
+            CHECK(caller != std::string::npos);
+            CHECK(raise < caller);
+            // No frames of failsafe itself above the THROW site
+            CHECK(frame_line(trace, 0).find("stack_trace_test_raise") != std::string::npos);
+            CHECK(trace.find("failsafe::") == std::string::npos);
+#endif
+            // The second time through the symbol cache
+            CHECK(traces[1] == trace);
+        }
+    }
+
+    TEST_CASE("Failed enforcements start at the ENFORCE site") {
+        for (stack_capture mode : {stack_capture::frame_pointers, stack_capture::unwinder}) {
+            capture_mode_scope scope(mode);
+            std::string trace;
+            volatile int value = 4; // no constant propagated clone of the caller
+            try {
+                stack_trace_test_enforce_caller(value);
+            } catch (const std::exception& e) {
+                trace = failsafe::exception::get_nested_trace(e);
+            }
+            CHECK(trace.find("value > 10") != std::string::npos);
+            REQUIRE(has_frames(trace));
+#if defined(__linux__) || defined(__APPLE__)
+            // Frame #0 may be the unnamed cold part of stack_trace_test_enforce
+            CHECK(frame_line(trace, 1).find("stack_trace_test_enforce_caller") != std::string::npos);
+            CHECK(trace.find("failsafe::") == std::string::npos);
+#endif
+        }
+    }
+
+    TEST_CASE("Each level of a chain has its own call stack") {
+        capture_mode_scope scope(stack_capture::unwinder);
+        try {
+            try {
+                stack_trace_test_caller(3);
+            } catch (...) {
+                THROW(std::logic_error, "Outer");
+            }
+        } catch (const std::logic_error& e) {
+            std::string trace = failsafe::exception::get_nested_trace(e);
+            auto outer = trace.find("Outer");
+            auto inner = trace.find("Raised with 3");
+            REQUIRE(outer != std::string::npos);
+            REQUIRE(inner != std::string::npos);
+            CHECK(trace.find("\n  #0 ", outer) < inner);
+            CHECK(trace.find("\n    #0 ", inner) != std::string::npos);
+        }
+    }
+}
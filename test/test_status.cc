@@ -0,0 +1,135 @@
+//
+// Unit tests for failsafe::status and STATUS_ERROR
+//
+
+#include <doctest/doctest.h>
+#include <failsafe/status.hh>
+
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace {
+    static_assert(sizeof(failsafe::status) == sizeof(void*), "a status is one pointer");
+    static_assert(std::is_nothrow_move_constructible_v<failsafe::status>);
+
+    int reply_line = 0;
+
+    failsafe::status fetch(bool reply, int timeout_ms) {
+        if (!reply) {
+            reply_line = __LINE__ + 1;
+            return STATUS_ERROR(std::errc::timed_out, "No reply within", timeout_ms, "ms");
+        }
+        return {};
+    }
+
+    failsafe::status fetch_twice(bool first, bool second) {
+        PROPAGATE_STATUS(fetch(first, 10));
+        PROPAGATE_STATUS(fetch(second, 20));
+        return {};
+    }
+
+    enum class rpc_error {
+        not_found = 1
+    };
+
+    class rpc_category : public std::error_category {
+        public:
+            const char* name() const noexcept override {
+                return "rpc";
+            }
+
+            std::string message(int code) const override {
+                return code == 1 ? "not found" : "unknown";
+            }
+    };
+
+    std::error_code make_error_code(rpc_error e) {
+        static const rpc_category category;
+        return {static_cast<int>(e), category};
+    }
+}
+
+namespace std {
+    template<>
+    struct is_error_code_enum<rpc_error> : true_type {};
+}
+
+TEST_SUITE("Status") {
+    TEST_CASE("Success") {
+        failsafe::status s = fetch(true, 10);
+        CHECK(s.ok());
+        CHECK(static_cast<bool>(s));
+        CHECK_FALSE(s.code());
+        CHECK(s.site() == nullptr);
+        CHECK(s.message().empty());
+        CHECK(s.to_string().empty());
+        CHECK_NOTHROW(s.throw_if_error());
+    }
+
+    TEST_CASE("Failure carries code, location and message") {
+        failsafe::status s = fetch(false, 250);
+        REQUIRE_FALSE(s.ok());
+        CHECK(s.code() == std::errc::timed_out);
+        CHECK(s.code().category() == std::generic_category());
+        REQUIRE(s.site() != nullptr);
+        CHECK(s.site()->line == reply_line);
+        CHECK(s.site()->id == failsafe::detail::site_id(s.site()->file, reply_line));
+
+        const std::string code_text = std::make_error_code(std::errc::timed_out).message();
+        CHECK(s.message() == "No reply within 250 ms (generic: " + code_text + ")");
+        CHECK(s.to_string().find("test_status.cc") != std::string::npos);
+        CHECK(s.to_string().find(s.message()) != std::string::npos);
+    }
+
+    TEST_CASE("Codes without a message and custom categories") {
+        failsafe::status s = STATUS_ERROR(rpc_error::not_found);
+        CHECK(s.code() == rpc_error::not_found);
+        CHECK(s.message() == "rpc: not found");
+
+        failsafe::status from_code = STATUS_ERROR(std::error_code(5, std::system_category()), "Read failed");
+        CHECK(from_code.code().value() == 5);
+        CHECK(from_code.message().rfind("Read failed (system: ", 0) == 0);
+    }
+
+    TEST_CASE("Copies and moves") {
+        failsafe::status original = fetch(false, 5);
+        failsafe::status copy = original;
+        CHECK(copy.code() == original.code());
+        CHECK(copy.site() == original.site());
+        CHECK(copy.message() == original.message());
+
+        failsafe::status moved = std::move(copy);
+        CHECK(moved.message() == original.message());
+
+        moved = failsafe::status{};
+        CHECK(moved.ok());
+        moved = original;
+        CHECK_FALSE(moved.ok());
+    }
+
+    TEST_CASE("Propagation") {
+        CHECK(fetch_twice(true, true).ok());
+
+        failsafe::status first = fetch_twice(false, true);
+        CHECK(first.message().find("within 10 ms") != std::string::npos);
+
+        failsafe::status second = fetch_twice(true, false);
+        CHECK(second.message().find("within 20 ms") != std::string::npos);
+    }
+
+    TEST_CASE("Conversion to exceptions at API boundaries") {
+        failsafe::status s = fetch(false, 7);
+        try {
+            s.throw_if_error();
+            FAIL("Should have thrown");
+        } catch (const std::runtime_error& e) {
+            std::string msg(e.what());
+            CHECK(msg.find("test_status.cc") != std::string::npos);
+            CHECK(msg.find("No reply within 7 ms") != std::string::npos);
+        }
+
+        CHECK_THROWS_AS(s.throw_if_error<std::logic_error>(), std::logic_error);
+    }
+}
@@ -1,9 +1,49 @@
 #include <doctest/doctest.h>
 #include <failsafe/detail/string_utils.hh>
+#include <cctype>
+#include <cstdint>
+#include <iomanip>
 #include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
 
 using namespace failsafe::detail;
 
+namespace {
+    // Straightforward renderers the table/SIMD based ones are checked against
+    std::string reference_hex(std::uint64_t value, std::size_t width, bool show_base, bool upper) {
+        std::ostringstream oss;
+        if (show_base && (value != 0 || width > 0)) {
+            oss << "0x";
+        }
+        if (upper) {
+            oss << std::uppercase;
+        }
+        oss << std::hex << std::setw(static_cast<int>(width)) << std::setfill('0') << value;
+        return oss.str();
+    }
+
+    std::string reference_bin(std::uint64_t value, unsigned width, unsigned group) {
+        std::size_t bits = width;
+        if (bits == 0) {
+            bits = 1;
+            for (std::uint64_t v = value >> 1; v != 0; v >>= 1) {
+                ++bits;
+            }
+        }
+        std::string result;
+        for (std::size_t i = bits; i-- > 0;) {
+            std::size_t count = bits - 1 - i;
+            if (count > 0 && group > 0 && count % group == 0) {
+                result += ' ';
+            }
+            result += (i < 64 && ((value >> i) & 1U)) ? '1' : '0';
+        }
+        return result;
+    }
+}
+
 TEST_SUITE("string formatters") {
     TEST_CASE("uppercase formatter") {
         SUBCASE("basic string") {
@@ -37,6 +77,54 @@ TEST_SUITE("string formatters") {
             CHECK(build_message(lowercase(path)) == "/home/user/file.txt");
         }
     }
+
+    TEST_CASE("case conversion") {
+        SUBCASE("only the wrapped value is converted") {
+            CHECK(build_message("Keep", uppercase("this"), "As Is") == "Keep THIS As Is");
+            CHECK(build_message(std::string(40, 'X'), lowercase("ABC")) == std::string(40, 'X') + " abc");
+        }
+
+        SUBCASE("long ASCII runs") {
+            const std::string mixed = "The Quick Brown Fox @[`{ Jumps Over 0123456789 Lazy Dogs";
+            std::string upper = mixed;
+            std::string lower = mixed;
+            for (char& c : upper) c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+            for (char& c : lower) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            CHECK(build_message(uppercase(mixed)) == upper);
+            CHECK(build_message(lowercase(mixed)) == lower);
+        }
+
+        SUBCASE("UTF-8 letters") {
+            CHECK(build_message(uppercase("caf\xC3\xA9 \xC5\x82\xC3\xB3" "d\xC5\xBA")) ==
+                  "CAF\xC3\x89 \xC5\x81\xC3\x93" "D\xC5\xB9");
+            CHECK(build_message(lowercase("\xCE\x91\xCE\x98\xCE\x97\xCE\x9D\xCE\x91 \xD0\x9C\xD0\x9E\xD0\xA1\xD0\x9A\xD0\x92\xD0\x90")) ==
+                  "\xCE\xB1\xCE\xB8\xCE\xB7\xCE\xBD\xCE\xB1 \xD0\xBC\xD0\xBE\xD1\x81\xD0\xBA\xD0\xB2\xD0\xB0");
+            // Letters whose other case has a different length stay as they are
+            CHECK(build_message(uppercase("stra\xC3\x9F" "e")) == "STRA\xC3\x9F" "E");
+        }
+
+        SUBCASE("non-ASCII inside long runs") {
+            const std::string text = "prefix-long-enough-for-a-block \xC3\xA0 and a three byte \xE2\x82\xAC sign";
+            CHECK(build_message(uppercase(text)) ==
+                  "PREFIX-LONG-ENOUGH-FOR-A-BLOCK \xC3\x80 AND A THREE BYTE \xE2\x82\xAC SIGN");
+        }
+
+        SUBCASE("malformed UTF-8 is left unchanged") {
+            CHECK(build_message(uppercase(std::string("a\xC3" "b\xA9z"))) == "A\xC3" "B\xA9Z");
+        }
+
+        SUBCASE("wide literals") {
+            CHECK(build_message(uppercase(L"wide \u00e9")) == "WIDE \xC3\x89");
+        }
+
+        SUBCASE("transform_case directly") {
+            std::string text = "Mixed \xD0\xB4\xD0\x94 Case";
+            transform_case<letter_case::upper>(text.data(), text.size());
+            CHECK(text == "MIXED \xD0\x94\xD0\x94 CASE");
+            transform_case<letter_case::lower>(text.data(), text.size());
+            CHECK(text == "mixed \xD0\xB4\xD0\xB4 case");
+        }
+    }
     
     TEST_CASE("hex formatter") {
         SUBCASE("basic values") {
@@ -171,4 +259,129 @@ TEST_SUITE("string formatters") {
             CHECK(build_message(lowercase("")) == "");
         }
     }
+
+    TEST_CASE("hexdump formatter") {
+        const std::string text = "GET / HTTP/1.1\r\nHost: a";
+
+        SUBCASE("classic layout") {
+            CHECK(build_message(hexdump(text)) ==
+                  "00000000  47 45 54 20 2f 20 48 54  54 50 2f 31 2e 31 0d 0a  |GET / HTTP/1.1..|\n"
+                  "00000010  48 6f 73 74 3a 20 61                              |Host: a|");
+        }
+
+        SUBCASE("width, case and base offset") {
+            hexdump_options opts;
+            opts.width = 4;
+            opts.uppercase = true;
+            opts.base_offset = 0x1000;
+            const unsigned char bytes[] = {0xDE, 0xAD, 0xBE, 0xEF, 0x00, 0x7F};
+            CHECK(build_message(hexdump(bytes, sizeof(bytes), opts)) ==
+                  "00001000  DE AD BE EF  |....|\n"
+                  "00001004  00 7F        |..|");
+        }
+
+        SUBCASE("without ascii column") {
+            hexdump_options opts;
+            opts.show_ascii = false;
+            opts.width = 8;
+            std::vector<std::uint8_t> bytes{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+            CHECK(build_message(hexdump(bytes, opts)) ==
+                  "00000000  01 02 03 04 05 06 07 08\n"
+                  "00000008  09 0a");
+        }
+
+        SUBCASE("truncation") {
+            hexdump_options opts;
+            opts.max_bytes = 4;
+            CHECK(build_message(hexdump(text, opts)) ==
+                  "00000000  47 45 54 20                                       |GET |\n"
+                  "... 19 more bytes");
+        }
+
+#if FAILSAFE_HAS_CONCEPTS
+        SUBCASE("std::byte spans") {
+            const std::byte bytes[] = {std::byte{0x41}, std::byte{0x0a}};
+            CHECK(build_message(hexdump(std::span<const std::byte>(bytes))) ==
+                  "00000000  41 0a" + std::string(45, ' ') + "|A.|");
+        }
+#endif
+
+        SUBCASE("empty and large buffers") {
+            CHECK(build_message(hexdump(nullptr, 0)) == "");
+
+            std::vector<unsigned char> big(4096);
+            for (std::size_t i = 0; i < big.size(); ++i) {
+                big[i] = static_cast<unsigned char>(i);
+            }
+            const std::string dump = build_message(hexdump(big));
+            CHECK(dump.size() == 256 * 79 - 1);
+            CHECK(dump.substr(0, 78) ==
+                  "00000000  00 01 02 03 04 05 06 07  08 09 0a 0b 0c 0d 0e 0f  |................|");
+            CHECK(dump.substr(dump.size() - 78) ==
+                  "00000ff0  f0 f1 f2 f3 f4 f5 f6 f7  f8 f9 fa fb fc fd fe ff  |................|");
+        }
+    }
+
+    TEST_CASE("radix rendering matches reference") {
+        const std::vector<std::uint64_t> values = {
+            0, 1, 2, 9, 10, 15, 16, 0x7F, 0x80, 0xFF, 0x100, 0xABCD, 0x8000,
+            0x12345678, 0x80000000, 0xFFFFFFFF, 0x123456789ABCDEF0ULL,
+            0x8000000000000000ULL, std::numeric_limits<std::uint64_t>::max()
+        };
+
+        SUBCASE("hex of 64-bit values") {
+            for (auto value : values) {
+                for (unsigned width : {0U, 1U, 4U, 16U, 20U}) {
+                    CHECK(build_message(hex(value, width)) == reference_hex(value, width, true, false));
+                    CHECK(build_message(hex(value, width, false, true)) == reference_hex(value, width, false, true));
+                }
+            }
+        }
+
+        SUBCASE("hex of narrow and signed values") {
+            CHECK(build_message(hex(std::uint8_t{0xA5})) == "0xa5");
+            CHECK(build_message(hex(std::int16_t{-2})) == "0xfffe");
+            CHECK(build_message(hex(std::int32_t{-1}, 0, true, true)) == "0xFFFFFFFF");
+            CHECK(build_message(hex(std::int64_t{-1})) == "0xffffffffffffffff");
+        }
+
+        SUBCASE("binary of 64-bit values") {
+            for (auto value : values) {
+                for (unsigned width : {0U, 1U, 8U, 33U, 64U, 70U}) {
+                    for (unsigned group : {0U, 1U, 3U, 4U, 8U}) {
+                        CHECK(build_message(bin(value, width, false, group)) == reference_bin(value, width, group));
+                    }
+                }
+            }
+        }
+
+        SUBCASE("binary of narrow values") {
+            CHECK(build_message(bin(std::uint8_t{0x81}, 0, true, 4)) == "0b1000 0001");
+            CHECK(build_message(bin(std::int8_t{-1}, 0, false)) == "11111111");
+            CHECK(build_message(bin(std::uint16_t{0x0F0F}, 12, false, 4)) == "1111 0000 1111");
+            CHECK(build_message(bin(std::uint8_t{3}, 12, false)) == "000000000011");
+            // Wider than the internal buffer
+            CHECK(build_message(bin(std::uint8_t{5}, 300, false, 4)) == reference_bin(5, 300, 4));
+            CHECK(build_message(hex(0xABU, 300)) == reference_hex(0xAB, 300, true, false));
+        }
+
+        SUBCASE("byte buffers") {
+            std::vector<unsigned char> bytes;
+            std::string expected;
+            for (unsigned i = 0; i < 41; ++i) {
+                bytes.push_back(static_cast<unsigned char>(i * 37 + 5));
+                expected += reference_hex(bytes.back(), 2, false, false);
+            }
+            std::string lower(2 * bytes.size(), '?');
+            format_hex_bytes(lower.data(), bytes.data(), bytes.size(), false);
+            CHECK(lower == expected);
+
+            std::string upper(2 * bytes.size(), '?');
+            format_hex_bytes(upper.data(), bytes.data(), bytes.size(), true);
+            for (auto& c : expected) {
+                c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+            }
+            CHECK(upper == expected);
+        }
+    }
 }
\ No newline at end of file
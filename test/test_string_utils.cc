@@ -4,7 +4,9 @@
 
 #include <filesystem>
 #include <chrono>
+#include <ctime>
 #include <optional>
+#include <sstream>
 #include <variant>
 #include <string>
 #include <vector>
@@ -137,6 +139,53 @@ TEST_SUITE("string_utils") {
             // Should show duration since epoch
             CHECK(result.find("since epoch") != std::string::npos);
         }
+
+        SUBCASE("known dates") {
+            using std::chrono::system_clock;
+            // 2024-02-29T23:59:59.123Z
+            auto tp = system_clock::time_point{} + 1709251199s + 123ms;
+            CHECK(build_message(tp) == "2024-02-29T23:59:59.123Z");
+            CHECK(build_message(tp + 1s) == "2024-03-01T00:00:00.123Z");
+            // Before the epoch the fraction still counts forward within the second
+            CHECK(build_message(system_clock::time_point{} - 1ms) == "1969-12-31T23:59:59.999Z");
+        }
+    }
+
+    TEST_CASE("format_timestamp") {
+        using std::chrono::system_clock;
+        auto render = [](system_clock::time_point tp, int precision,
+                         timestamp_zone zone = timestamp_zone::utc, char separator = 'T') {
+            char buffer[timestamp_max_length];
+            return std::string(buffer, format_timestamp(buffer, tp, zone, separator, precision));
+        };
+        const auto tp = system_clock::time_point{} + 951782400s + 7ms;
+
+        SUBCASE("precision") {
+            CHECK(render(tp, 0) == "2000-02-29T00:00:00");
+            CHECK(render(tp, 3) == "2000-02-29T00:00:00.007");
+            CHECK(render(tp, 6) == "2000-02-29T00:00:00.007000");
+            CHECK(render(tp + 1us, 6) == "2000-02-29T00:00:00.007001");
+        }
+
+        SUBCASE("separator") {
+            CHECK(render(tp, 3, timestamp_zone::utc, ' ') == "2000-02-29 00:00:00.007");
+        }
+
+        SUBCASE("cached second is reused and replaced") {
+            CHECK(render(tp, 3) == "2000-02-29T00:00:00.007");
+            CHECK(render(tp + 500ms, 3) == "2000-02-29T00:00:00.507");
+            CHECK(render(tp + 86400s, 3) == "2000-03-01T00:00:00.007");
+            CHECK(render(tp, 3) == "2000-02-29T00:00:00.007");
+        }
+
+        SUBCASE("local time matches localtime") {
+            const std::time_t time = system_clock::to_time_t(tp);
+            std::tm tm{};
+            REQUIRE(safe_localtime(&time, &tm) != nullptr);
+            char expected[32];
+            const std::size_t length = std::strftime(expected, sizeof(expected), "%Y-%m-%d %H:%M:%S", &tm);
+            CHECK(render(tp, 3, timestamp_zone::local, ' ') == std::string(expected, length) + ".007");
+        }
     }
 
     TEST_CASE("build_message with optional") {
@@ -556,6 +605,48 @@ TEST_SUITE("string_utils") {
         }
     }
 
+    TEST_CASE("type-erased arguments") {
+        SUBCASE("argument kinds") {
+            int value = 1;
+            const std::string text = "text";
+            CHECK(make_format_arg(true).type == format_arg::kind::boolean);
+            CHECK(make_format_arg(short{-1}).type == format_arg::kind::signed_integer);
+            CHECK(make_format_arg(42u).type == format_arg::kind::unsigned_integer);
+            CHECK(make_format_arg(1.5f).type == format_arg::kind::floating);
+            CHECK(make_format_arg("literal").type == format_arg::kind::string);
+            CHECK(make_format_arg(text).type == format_arg::kind::string);
+            CHECK(make_format_arg(&value).type == format_arg::kind::pointer);
+            CHECK(make_format_arg('c').type == format_arg::kind::custom);
+            CHECK(make_format_arg(1.5L).type == format_arg::kind::custom);
+            CHECK(make_format_arg(std::vector<int>{1}).type == format_arg::kind::custom);
+        }
+
+        SUBCASE("values stored by value") {
+            CHECK(build_message(short{-7}, 7u, -8LL, 18446744073709551615ULL) ==
+                  "-7 7 -8 18446744073709551615");
+            CHECK(build_message(0.1f, 2.5, 1e20) == "0.1 2.5 1e+20");
+            const char* null_text = nullptr;
+            char buffer[8] = "abc";
+            CHECK(build_message(null_text, buffer, std::string_view("view")) == "nullptr abc view");
+        }
+
+        SUBCASE("character types are not integers") {
+            unsigned char byte = 'x';
+            CHECK(build_message('a', byte, static_cast<signed char>('y')) == "a x y");
+        }
+
+        SUBCASE("custom arguments keep their value category") {
+            std::vector<int> values{1, 2};
+            CHECK(build_message(values, std::vector<int>{3}, std::optional<int>{4}) == "[1, 2] [3] 4");
+        }
+
+        SUBCASE("explicit argument array") {
+            const format_arg args[] = {make_format_arg("a"), make_format_arg(1), make_format_arg(false)};
+            CHECK(build_message_from_args(format_args{args, 3}) == "a 1 false");
+            CHECK(build_message_from_args(format_args{}) == "");
+        }
+    }
+
     TEST_CASE("build_message with wstring") {
         SUBCASE("basic wstring") {
             std::wstring ws = L"Hello World";
@@ -637,5 +728,71 @@ TEST_SUITE("string_utils") {
             std::wstring ws = L"HELLO WORLD";
             CHECK(build_message("Lower:", lowercase(ws)) == "Lower: hello world");
         }
+
+        SUBCASE("wstring_view and wide arrays") {
+            std::wstring_view view = L"view";
+            wchar_t buffer[] = L"buffer";
+            CHECK(build_message(view, buffer, L"literal") == "view buffer literal");
+        }
+
+        SUBCASE("long ASCII wstring with non-ASCII interleaved") {
+            std::wstring ws(1000, L'a');
+            std::string expected(1000, 'a');
+            ws[17] = L'\u00e9';
+            expected.replace(17, 1, "\xC3\xA9");
+            ws[999] = L'\u20ac';
+            expected.replace(expected.size() - 1, 1, "\xE2\x82\xAC");
+            CHECK(build_message(ws) == expected);
+        }
+
+        SUBCASE("invalid code units become U+FFFD") {
+            std::wstring ws = L"a";
+            ws.push_back(static_cast<wchar_t>(0xD800));
+            ws.push_back(L'b');
+            CHECK(build_message(ws) == "a\xEF\xBF\xBD" "b");
+        }
+    }
+
+    TEST_CASE("utf8 transcoding") {
+        auto transcode = [](const auto& units) {
+            std::string out;
+            sink_write_utf8(out, units.data(), units.size());
+            return out;
+        };
+
+        SUBCASE("UTF-16") {
+            std::u16string text = u"ASCII only text, long enough for a block";
+            CHECK(transcode(text) == "ASCII only text, long enough for a block");
+            CHECK(transcode(std::u16string(u"\u00e9\u4e16\U0001F30D")) == "\xC3\xA9\xE4\xB8\x96\xF0\x9F\x8C\x8D");
+        }
+
+        SUBCASE("UTF-16 unpaired surrogates") {
+            const std::string replacement = "\xEF\xBF\xBD";
+            CHECK(transcode(std::u16string{u'x', char16_t{0xDC00}, u'y'}) == "x" + replacement + "y");
+            CHECK(transcode(std::u16string{u'x', char16_t{0xD83C}}) == "x" + replacement);
+            CHECK(transcode(std::u16string{char16_t{0xD83C}, char16_t{0xD83C}, char16_t{0xDF0D}}) ==
+                  replacement + "\xF0\x9F\x8C\x8D");
+        }
+
+        SUBCASE("UTF-32 out of range values") {
+            const std::string replacement = "\xEF\xBF\xBD";
+            CHECK(transcode(std::u32string{U'a', char32_t{0xDFFF}, char32_t{0x110000}, char32_t{0x10FFFF}}) ==
+                  "a" + replacement + replacement + "\xF4\x8F\xBF\xBF");
+        }
+
+        SUBCASE("output buffer boundaries") {
+            // Multi-byte sequences straddling the internal buffer size
+            std::u32string text;
+            std::string expected;
+            for (int i = 0; i < 700; ++i) {
+                text += U"a\U0001F30D";
+                expected += "a\xF0\x9F\x8C\x8D";
+            }
+            CHECK(transcode(text) == expected);
+
+            std::ostringstream oss;
+            sink_write_utf8(oss, text.data(), text.size());
+            CHECK(oss.str() == expected);
+        }
     }
 }
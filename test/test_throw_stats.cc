@@ -0,0 +1,195 @@
+//
+// Unit tests for the per call site throw counters and their reports
+//
+
+#include <doctest/doctest.h>
+#include <failsafe/enforce.hh>
+#include <failsafe/exception.hh>
+#include <failsafe/logger.hh>
+#include <failsafe/throw_stats.hh>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    // Atomic: also written by the throwing threads
+    std::atomic <int> frequent_line{0};
+    std::atomic <int> rare_line{0};
+    std::atomic <int> enforce_line{0};
+
+    void throw_frequent() {
+        frequent_line = __LINE__ + 1;
+        THROW(std::runtime_error, "Frequent");
+    }
+
+    void throw_rare() {
+        rare_line = __LINE__ + 1;
+        THROW(std::logic_error, "Rare");
+    }
+
+    void enforce_positive(int value) {
+        enforce_line = __LINE__ + 1;
+        ENFORCE(value > 0)("Not positive:", value);
+    }
+
+    template<typename F>
+    void swallow(F&& f) {
+        try {
+            f();
+        } catch (const std::exception&) {
+        }
+    }
+
+    bool is_this_file(const char* file) {
+        return std::string(file).find("test_throw_stats.cc") != std::string::npos;
+    }
+
+    // Collects log messages of the "throw_sites" category
+    class log_capture {
+        public:
+            log_capture()
+                : original_level_(failsafe::logger::get_config().min_level.load()) {
+                failsafe::logger::set_backend([this](int, const char* category, const char* file, int line,
+                                                     const std::string& message) {
+                    if (std::string(category) == "throw_sites") {
+                        std::lock_guard <std::mutex> lock(mutex_);
+                        entries_.push_back({file, line, message});
+                    }
+                });
+                failsafe::logger::set_min_level(LOGGER_LEVEL_TRACE);
+            }
+
+            ~log_capture() {
+                failsafe::logger::reset_backend();
+                failsafe::logger::set_min_level(original_level_);
+            }
+
+            struct entry {
+                std::string file;
+                int line;
+                std::string message;
+            };
+
+            std::vector <entry> entries() {
+                std::lock_guard <std::mutex> lock(mutex_);
+                return entries_;
+            }
+
+        private:
+            int original_level_;
+            std::mutex mutex_;
+            std::vector <entry> entries_;
+    };
+}
+
+TEST_SUITE("Throw stats") {
+    TEST_CASE("Sites are counted and ranked") {
+        failsafe::exception::reset_throw_counts();
+        for (int i = 0; i < 3; ++i) {
+            swallow(throw_frequent);
+        }
+        swallow(throw_rare);
+
+        auto sites = failsafe::exception::top_throw_sites(10);
+        REQUIRE(sites.size() == 2);
+        CHECK(sites[0].count == 3);
+        CHECK(sites[0].line == frequent_line);
+        CHECK(is_this_file(sites[0].file));
+        CHECK(std::string(sites[0].expression).empty());
+        CHECK(sites[0].per_second > 0);
+        CHECK(sites[1].count == 1);
+        CHECK(sites[1].line == rare_line);
+
+        CHECK(failsafe::exception::top_throw_sites(1).size() == 1);
+    }
+
+    TEST_CASE("Enforcements are counted with their expression") {
+        failsafe::exception::reset_throw_counts();
+        swallow([] { enforce_positive(-1); });
+        swallow([] { enforce_positive(-2); });
+        swallow([] { enforce_positive(3); });
+        // The expression does not stick to later throws of the thread
+        swallow(throw_frequent);
+
+        auto sites = failsafe::exception::top_throw_sites(10);
+        REQUIRE(sites.size() == 2);
+        CHECK(sites[0].count == 2);
+        CHECK(sites[0].line == enforce_line);
+        CHECK(std::string(sites[0].expression) == "value > 0");
+        CHECK(sites[1].line == frequent_line);
+        CHECK(std::string(sites[1].expression).empty());
+    }
+
+    TEST_CASE("Counts of all threads are summed") {
+        failsafe::exception::reset_throw_counts();
+        std::vector <std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([] {
+                for (int i = 0; i < 100; ++i) {
+                    swallow(throw_frequent);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        auto sites = failsafe::exception::top_throw_sites(10);
+        REQUIRE(sites.size() == 1);
+        CHECK(sites[0].count == 400);
+    }
+
+    TEST_CASE("Reset zeroes the counts") {
+        swallow(throw_rare);
+        CHECK_FALSE(failsafe::exception::top_throw_sites(10).empty());
+        failsafe::exception::reset_throw_counts();
+        CHECK(failsafe::exception::top_throw_sites(10).empty());
+    }
+
+    TEST_CASE("Top sites are logged at their location") {
+        log_capture capture;
+        failsafe::exception::reset_throw_counts();
+        swallow(throw_frequent);
+        swallow(throw_frequent);
+        swallow([] { enforce_positive(0); });
+
+        failsafe::exception::log_top_throw_sites(10, LOGGER_LEVEL_WARN);
+        auto entries = capture.entries();
+        REQUIRE(entries.size() == 2);
+        CHECK(entries[0].line == frequent_line);
+        CHECK(is_this_file(entries[0].file.c_str()));
+        CHECK(entries[0].message.find("Throw site 1 - 2 exceptions,") == 0);
+        CHECK(entries[1].message.find("Throw site 2 - 1 exceptions,") == 0);
+        CHECK(entries[1].message.find("- enforcing value > 0") != std::string::npos);
+    }
+
+    TEST_CASE("The reporter logs the sites of each interval") {
+        log_capture capture;
+        failsafe::exception::reset_throw_counts();
+        swallow(throw_rare); // before the reporter: not reported
+
+        {
+            failsafe::exception::throw_site_reporter reporter(std::chrono::milliseconds(200), 5);
+            for (int i = 0; i < 5; ++i) {
+                swallow(throw_frequent);
+            }
+            auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while (capture.entries().empty() && std::chrono::steady_clock::now() < deadline) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+
+        auto entries = capture.entries();
+        REQUIRE_FALSE(entries.empty());
+        for (const auto& entry : entries) {
+            CHECK(entry.line != rare_line);
+        }
+        CHECK(entries[0].line == frequent_line);
+        CHECK(entries[0].message.find("Throw site 1 - 5 exceptions,") == 0);
+    }
+}